@@ -79,6 +79,7 @@
 #include "Media/MediaPlayer.h"
 
 #include "Library/Application/PlatformApplication.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Platform/Platform.h"
 #include "Platform/Filters/FilteringEventHandler.h"
@@ -120,9 +121,10 @@ void initDataPath(const std::string &dataPath) {
     }
 }
 
-Game::Game(PlatformApplication *application, std::shared_ptr<GameConfig> config) {
+Game::Game(PlatformApplication *application, std::shared_ptr<GameConfig> config, bool headless) {
     _application = application;
     _config = config;
+    _headless = headless;
     _log = EngineIocContainer::ResolveLogger();
     _decalBuilder = EngineIocContainer::ResolveDecalBuilder();
     _vis = EngineIocContainer::ResolveVis();
@@ -156,7 +158,8 @@ Game::~Game() {
 }
 
 int Game::run() {
-    _render = IRenderFactory().Create(_config);
+    // Headless runs don't touch the config entry, it's saved on exit.
+    _render = IRenderFactory().Create(_headless ? RendererType::Null : _config->graphics.Renderer.value(), _config);
     ::render = _render;
 
     if (!_render) {
@@ -2252,6 +2255,21 @@ void Game::processQueuedMessages() {
                     _render->ReloadShaders();
                     pAudioPlayer->playUISound(SOUND_StartMainChoice02);
                     continue;
+                case UIMSG_DebugProfiler:
+                    _engine->config->debug.Profiler.toggle();
+                    pAudioPlayer->playUISound(SOUND_StartMainChoice02);
+                    continue;
+                case UIMSG_DebugProfilerDump: {
+                    const std::string &path = _engine->config->debug.ProfilerDumpPath.value();
+                    try {
+                        size_t count = Profiler::dumpChromeTrace(path);
+                        GameUI_SetStatusBar(fmt::format("Profiler: {} zones written to {}", count, path));
+                    } catch (const std::exception &e) {
+                        logger->warning("Could not write profiler dump: {}", e.what());
+                    }
+                    pAudioPlayer->playUISound(SOUND_StartMainChoice02);
+                    continue;
+                }
                 default:
                     continue;
             }
@@ -2324,6 +2342,8 @@ void Game::gameLoop() {
 
         bool game_finished = false;
         do {
+            MM_PROFILE_ZONE("Frame");
+
             MessageLoopWithWait();
 
             _engine->_44EEA7();  // pop up . mouse picking
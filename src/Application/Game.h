@@ -25,7 +25,7 @@ class NuklearEventHandler;
 
 class Game {
  public:
-    Game(PlatformApplication *application, std::shared_ptr<GameConfig> config);
+    Game(PlatformApplication *application, std::shared_ptr<GameConfig> config, bool headless = false);
     ~Game();
 
     int run();
@@ -41,6 +41,7 @@ class Game {
  private:
     PlatformApplication *_application = nullptr;
     std::shared_ptr<GameConfig> _config;
+    bool _headless = false; // Use the null renderer instead of the one set in the config.
     std::unique_ptr<GameWindowHandler> _windowHandler;
     std::unique_ptr<NuklearEventHandler> _nuklearHandler;
     std::shared_ptr<Engine> _engine;
@@ -9,7 +9,8 @@
 
 MM_DEFINE_ENUM_SERIALIZATION_FUNCTIONS(RendererType, CASE_INSENSITIVE, {
     {RendererType::OpenGL, "OpenGL"},
-    {RendererType::OpenGLES, "OpenGLES"}
+    {RendererType::OpenGLES, "OpenGLES"},
+    {RendererType::Null, "Null"}
 })
 
 MM_DEFINE_ENUM_SERIALIZATION_FUNCTIONS(PlatformWindowMode, CASE_INSENSITIVE, {
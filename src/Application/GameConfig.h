@@ -65,6 +65,13 @@ class GameConfig : public Config {
 
         Bool ShowFPS = {this, "show_fps", false, "Show debug HUD with FPS and other debug information."};
 
+        Bool Profiler = {this, "profiler", false,
+                         "Record profiler zones and show per-zone timings for the last second. Profiler zones can be "
+                         "dumped in Chrome trace_event format from the debug menu."};
+
+        String ProfilerDumpPath = String(this, "profiler_dump_path", "openenroth_profile.json",
+                                         "Path to write profiler dumps to.");
+
         Bool ShowPickedFace = {this, "show_picked_face", false,
                                "Face pointed with mouse will flash with red for buildings or green for dungeons."};
 
@@ -86,6 +93,10 @@ class GameConfig : public Config {
 
         Bool VerboseLogging = {this, "verbose_logging", false, "Verbose logging to debug console. Can be extremely spammy."};
 
+        Bool VerifyItemsBonusCache = {this, "verify_items_bonus_cache", false,
+                                      "Recompute cached character item bonuses on every access and fail if they don't "
+                                      "match. Slow, meant for running game traces."};
+
         Int TraceFrameTimeMs = {this, "trace_frame_time_ms", 50, &ValidateFrameTime,
                                 "Number of milliseconds per frame when recording game traces."};
 
@@ -117,6 +128,10 @@ class GameConfig : public Config {
                               "Maximum allowed slack for point-inside-a-polygon checks when calculating floor z level. "
                               "This is needed because there are actual holes in level geometry sometimes, up to several units wide."};
 
+        Int FullAiActorLimit = {this, "full_ai_actor_limit", 30, &ValidateFullAiActorLimit,
+                                "Max number of actors near the party that are fully processed by AI every frame. "
+                                "Was 30 in vanilla."};
+
         Int Gravity = {this, "gravity", 5, "Gravity strength, the higher the more gravity, 0 disables gravity completely."};
 
         Float KeyboardInteractionDepth = {this, "keyboard_interaction_depth", 512.0f, &ValidateInteractionDepth,
@@ -211,6 +226,9 @@ class GameConfig : public Config {
         static int ValidateFloorChecksEps(int eps) {
             return std::clamp(eps, 0, 10);
         }
+        static int ValidateFullAiActorLimit(int limit) {
+            return std::clamp(limit, 1, 500); // 500 is the size of ai_near_actors_* arrays.
+        }
         static int ValidateRecovery(int recovery) {
             if (recovery < 0)
                 return 0;
@@ -308,7 +326,13 @@ class GameConfig : public Config {
      public:
         explicit Graphics(GameConfig *config): ConfigSection(config, "graphics") {}
 
-        ConfigEntry<RendererType> Renderer = {this, "renderer", ConfigRenderer, "Renderer to use, 'OpenGL' or 'OpenGLES'."};
+        ConfigEntry<RendererType> Renderer = {this, "renderer", ConfigRenderer, &ValidateRenderer, "Renderer to use, 'OpenGL' or 'OpenGLES'."};
+
+        Bool AsyncTextureLoading = {this, "async_texture_loading", false,
+                                    "Decode sprites and bitmaps on background threads, drawing them as transparent until they're ready."};
+
+        Int AsyncTextureUploadBudget = {this, "async_texture_upload_budget", 8, &ValidateAsyncTextureUploadBudget,
+                                        "Max number of asynchronously decoded textures to upload to the GPU per frame."};
 
         Bool BloodSplats = {this, "bloodsplats", true, "Enable bloodsplats under corpses."};
 
@@ -345,6 +369,9 @@ class GameConfig : public Config {
 
         Int MaxVisibleSectors = {this, "maxvisiblesectors", 10, &ValidateMaxSectors, "Max number of BSP sectors to display."};
 
+        Int ParticleLimit = {this, "particle_limit", 500, &ValidateParticleLimit,
+                             "Max number of particles alive at the same time. Vanilla limit is 500."};
+
         Bool SeasonsChange = {this, "seasons_change", true,
                               "Allow changing trees/ground depending on current season (originally was only used in MM6)."};
 
@@ -377,6 +404,16 @@ class GameConfig : public Config {
                             " 0 - disabled (render dimensions will always match window dimensions), 1 - linear filter, 2 - nearest filter"};
 
      private:
+        static RendererType ValidateRenderer(RendererType renderer) {
+            // Null renderer is only for headless runs, see GameStarterOptions::headless, and shouldn't be persisted.
+            return renderer == RendererType::Null ? ConfigRenderer : renderer;
+        }
+        static int ValidateAsyncTextureUploadBudget(int budget) {
+            return std::max(budget, 1);
+        }
+        static int ValidateParticleLimit(int limit) {
+            return std::clamp(limit, 1, 100000);
+        }
         static int ValidateGamma(int level) {
             return std::clamp(level, 0, 9);
         }
@@ -497,14 +534,29 @@ class GameConfig : public Config {
 
         Bool AlwaysRun = {this, "always_run", true, "Enable always run."};
 
+        Bool AsyncSaving = {this, "async_saving", false,
+                            "Encode, compress and write saves on a background thread, so that saving and location "
+                            "changes don't stall the game."};
+
         Bool FlipOnExit = {this, "flip_on_exit", false, "Flip 180 degrees when leaving a building."};
 
         Bool ShowHits = {this, "show_hits", true, "Show HP status in status bar."};
 
+        Bool StartupSnapshot = {this, "startup_snapshot", false,
+                                "Cache decompressed startup data from events.lod in data/events.snapshot, and load it "
+                                "from there on subsequent runs. The snapshot is rebuilt if events.lod changes."};
+
         Int MusicLevel = {this, "music_level", 3, &ValidateLevel, "Music volume level."};
 
         Int SoundLevel = {this, "sound_level", 4, &ValidateLevel, "Sound volume level."};
 
+        Int SoundCacheSize = {this, "sound_cache_size", 64, &ValidateSoundCacheSize,
+                              "Memory budget for decoded sounds, in megabytes. Least recently played sounds are "
+                              "dropped once it's exceeded."};
+
+        Bool PrewarmLevelSounds = {this, "prewarm_level_sounds", true,
+                                   "Decode sounds used by level monsters on level load, instead of on first use."};
+
         Int VoiceLevel = {this, "voice_level", 5, &ValidateLevel, "Voice volume level."};
 
         Int ScreenshotNumber = {this, "screenshot_number", 0, "Last saved screenshot number."};
@@ -521,6 +573,9 @@ class GameConfig : public Config {
         static int ValidateLevel(int level) {
             return std::clamp(level, 0, 9);
         }
+        static int ValidateSoundCacheSize(int size) {
+            return std::clamp(size, 1, 4096);
+        }
         static int ValidateVerticalTurnSpeed(int speed) {
             return std::clamp(speed, 1, 128);
         }
@@ -26,6 +26,10 @@ GameOptions GameOptions::Parse(int argc, char **argv) {
     CLI::App *retrace = app->add_subcommand("retrace", "Retrace traces and exit.")->fallthrough();
     retrace->add_option("TRACE", result.retrace.traces,
                         "Path to trace file(s) to retrace.")->check(CLI::ExistingFile)->required()->option_text("...");
+    retrace->add_flag("--headless", result.headless,
+                      "Run without a display, using null platform & renderer.");
+    retrace->add_flag("--fast-forward", result.retrace.fastForward,
+                      "Skip rendering of most frames, game logic is still run for every frame.");
     retrace->callback([&] {
         result.subcommand = SUBCOMMAND_RETRACE;
         result.configPath = "openenroth_retrace.ini"; // TODO(captainurist): we should just skip saving/loading the config.
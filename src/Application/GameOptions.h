@@ -17,6 +17,7 @@ struct GameOptions : public GameStarterOptions {
 
     struct RetraceOptions {
         std::vector<std::string> traces;
+        bool fastForward = false; // Skip presentation of most frames.
     };
 
     Subcommand subcommand = SUBCOMMAND_GAME;
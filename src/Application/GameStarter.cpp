@@ -6,8 +6,10 @@
 #include "Engine/Engine.h"
 
 #include "Library/Application/PlatformApplication.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Platform/PlatformLogger.h"
+#include "Platform/Null/NullPlatform.h"
 
 #include "GamePathResolver.h"
 #include "GameConfig.h"
@@ -23,7 +25,11 @@ GameStarter::GameStarter(GameStarterOptions options): _options(std::move(options
     EngineIocContainer::ResolveLogger()->setBaseLogger(_logger.get());
     Engine::LogEngineBuildInfo();
 
-    _application = std::make_unique<PlatformApplication>(_logger.get());
+    if (_options.headless) {
+        _application = std::make_unique<PlatformApplication>(_logger.get(), std::make_unique<NullPlatform>(_logger.get()));
+    } else {
+        _application = std::make_unique<PlatformApplication>(_logger.get());
+    }
     resolveDefaults(_application->platform(), &_options);
     initDataPath(_options.dataPath);
 
@@ -31,13 +37,16 @@ GameStarter::GameStarter(GameStarterOptions options): _options(std::move(options
     _config->debug.VerboseLogging.subscribe([this, setVerboseLogging](bool value) {
         setVerboseLogging(value || _options.verbose);
     });
+    _config->debug.Profiler.subscribe([](bool value) {
+        Profiler::setEnabled(value);
+    });
     if (_options.resetConfig) {
         _config->SaveConfiguration();
     } else {
         _config->LoadConfiguration();
     }
 
-    _game = std::make_unique<Game>(_application.get(), _config);
+    _game = std::make_unique<Game>(_application.get(), _config, _options.headless);
 }
 
 GameStarter::~GameStarter() {
@@ -7,4 +7,5 @@ struct GameStarterOptions {
     std::string dataPath; // Path to game data, empty means use default.
     bool resetConfig = false; // Reset config to default on startup.
     bool verbose = false;
+    bool headless = false; // Run without a display & GPU, using a null platform & renderer.
 };
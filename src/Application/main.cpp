@@ -1,4 +1,5 @@
 #include <cstdio>
+#include <filesystem>
 #include <utility>
 
 #include "Engine/Components/Control/EngineControlComponent.h"
@@ -21,11 +22,15 @@ int runRetrace(GameOptions options) {
     GameStarter starter(options);
     starter.config()->resetForTest();
 
-    starter.application()->get<EngineControlComponent>()->runControlRoutine([application = starter.application(), tracePaths = options.retrace.traces] (EngineController *game) {
+    starter.application()->get<EngineControlComponent>()->runControlRoutine([application = starter.application(), retrace = options.retrace] (EngineController *game) {
         game->tick(10); // Let the game thread initialize everything.
 
-        for (const std::string &tracePath : tracePaths) {
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
+        EngineTracePlaybackFlags flags = TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS;
+        if (retrace.fastForward)
+            flags |= TRACE_PLAYBACK_FAST_FORWARD;
+
+        for (const std::string &tracePath : retrace.traces) {
+            std::string savePath = std::filesystem::path(tracePath).replace_extension(".mm7").string();
 
             game->goToMainMenu();
 
@@ -34,7 +39,7 @@ int runRetrace(GameOptions options) {
             application->get<EngineTracePlayer>()->prepareTrace(game, savePath, tracePath);
             trace.header.startState = EngineTraceStateAccessor::makeGameState();
             application->get<EngineTraceComponent>()->start();
-            application->get<EngineTracePlayer>()->playPreparedTrace(game, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS);
+            application->get<EngineTracePlayer>()->playPreparedTrace(game, flags);
             trace.events = application->get<EngineTraceComponent>()->finish();
             trace.header.endState = EngineTraceStateAccessor::makeGameState();
             EventTrace::saveToFile(tracePath, trace);
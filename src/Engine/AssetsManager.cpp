@@ -2,15 +2,23 @@
 
 #include <algorithm>
 
+#include "Engine/Engine.h"
 #include "Engine/Graphics/IRender.h"
 #include "Engine/Graphics/ImageLoader.h"
 #include "Engine/Graphics/Texture.h"
 #include "GUI/GUIFont.h"
 
 #include "Utility/String.h"
+#include "Utility/ThreadPool.h"
 
 AssetsManager *assets = new AssetsManager();
 
+// Decoding is pretty light, and we don't want to compete with the main thread for cores.
+static constexpr size_t DECODE_THREAD_COUNT = 2;
+
+AssetsManager::AssetsManager() = default;
+AssetsManager::~AssetsManager() = default;
+
 void AssetsManager::releaseAllTextures() {
     logger->info("Render - Releasing Textures.");
     // clears any textures from gpu
@@ -23,6 +31,9 @@ void AssetsManager::releaseAllTextures() {
     for (auto spr : sprites) {
         render->DeleteTexture(spr.second);
     }
+    if (_placeholder) {
+        render->DeleteTexture(_placeholder);
+    }
 
     ReloadFonts();
 
@@ -200,3 +211,45 @@ bool AssetsManager::releaseSprite(const std::string &name) {
     return true;
 }
 
+bool AssetsManager::startAsyncLoad(Texture *texture) {
+    if (!engine->config->graphics.AsyncTextureLoading.value())
+        return false;
+
+    if (!_decodePool)
+        _decodePool = std::make_unique<ThreadPool>(DECODE_THREAD_COUNT);
+
+    if (!texture->StartAsyncLoad(_decodePool.get()))
+        return false;
+
+    _pendingUploads.push_back(texture);
+    return true;
+}
+
+void AssetsManager::cancelAsyncLoad(Image *image) {
+    std::erase(_pendingUploads, image);
+}
+
+void AssetsManager::uploadCompletedTextures(int budget) {
+    for (auto pos = _pendingUploads.begin(); pos != _pendingUploads.end() && budget > 0;) {
+        Image *image = *pos;
+
+        if (!image->IsAsyncLoadPending()) {
+            pos = _pendingUploads.erase(pos); // Was completed synchronously, e.g. through GetWidth().
+        } else if (image->IsAsyncLoadFinished()) {
+            image->CompleteAsyncLoad();
+            pos = _pendingUploads.erase(pos);
+            budget--;
+        } else {
+            ++pos;
+        }
+    }
+}
+
+Texture *AssetsManager::placeholderTexture() {
+    if (!_placeholder) {
+        uint32_t pixel = 0;
+        _placeholder = render->CreateTexture_Blank(1, 1, IMAGE_FORMAT_A8B8G8R8, &pixel);
+    }
+
+    return _placeholder;
+}
@@ -1,16 +1,20 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Utility/Color.h"
 
 class Image;
 class Texture;
+class ThreadPool;
 
 class AssetsManager {
  public:
-    AssetsManager() {}
+    AssetsManager();
+    ~AssetsManager();
 
     void releaseAllTextures();
 
@@ -31,6 +35,46 @@ class AssetsManager {
     Texture *getSprite(const std::string &name, unsigned int palette_id,
                        unsigned int lod_sprite_id);
 
+    /**
+     * Starts decoding the provided texture on a background thread, if async texture loading is enabled in the config
+     * and the texture's loader supports it. Once decoded, the texture will be uploaded to the GPU in
+     * `uploadCompletedTextures`.
+     *
+     * Note that only the conversion into RGBA pixels happens in the background. LOD reads and zlib decompression
+     * still happen right here on the main thread, see `ImageLoader::PrepareAsyncLoad`.
+     *
+     * @param texture                   Texture to start loading.
+     * @return                          Whether the async load was started.
+     */
+    bool startAsyncLoad(Texture *texture);
+
+    /**
+     * Stops tracking the async load for the provided image. Called when the image is released or destroyed.
+     */
+    void cancelAsyncLoad(Image *image);
+
+    /**
+     * Uploads the textures that have finished decoding in the background. Should be called once per frame on the main
+     * thread.
+     *
+     * @param budget                    Max number of textures to upload.
+     */
+    void uploadCompletedTextures(int budget);
+
+    /**
+     * @return                          Number of textures that were sent for async loading and haven't been uploaded
+     *                                  or released yet.
+     */
+    [[nodiscard]] size_t pendingUploadCount() const {
+        return _pendingUploads.size();
+    }
+
+    /**
+     * @return                          Transparent texture to draw in place of the textures that are still being
+     *                                  decoded in the background.
+     */
+    Texture *placeholderTexture();
+
     // TODO(pskelton): Contain better
     // TODO(pskelton): Manager should have a ref to all loose textures created throuh CreateTexture_Blank also
     Texture *winnerCert{ nullptr };
@@ -39,6 +83,11 @@ class AssetsManager {
     std::unordered_map<std::string, Texture *> bitmaps;
     std::unordered_map<std::string, Texture *> sprites;
     std::unordered_map<std::string, Texture *> images;
+
+ private:
+    std::unique_ptr<ThreadPool> _decodePool; // Created lazily, on first async load.
+    std::vector<Image *> _pendingUploads;
+    Texture *_placeholder = nullptr;
 };
 
 extern AssetsManager *assets;
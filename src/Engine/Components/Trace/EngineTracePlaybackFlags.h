@@ -6,6 +6,7 @@ enum class EngineTracePlaybackFlag {
     TRACE_PLAYBACK_SKIP_RANDOM_CHECKS = 0x1,
     TRACE_PLAYBACK_SKIP_TIME_CHECKS = 0x2,
     TRACE_PLAYBACK_SKIP_STATE_CHECKS = 0x4,
+    TRACE_PLAYBACK_FAST_FORWARD = 0x8, // Present only every Nth frame, see `EngineTracePlayer::setFastForwardInterval`.
 };
 using enum EngineTracePlaybackFlag;
 MM_DECLARE_FLAGS(EngineTracePlaybackFlags, EngineTracePlaybackFlag)
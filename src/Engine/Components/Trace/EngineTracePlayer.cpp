@@ -10,6 +10,7 @@
 #include "Engine/Components/Control/EngineController.h"
 #include "Engine/Components/Deterministic/EngineDeterministicComponent.h"
 #include "Engine/Engine.h"
+#include "Engine/Graphics/IRender.h"
 
 #include "Library/Trace/PaintEvent.h"
 #include "Library/Trace/EventTrace.h"
@@ -41,18 +42,19 @@ void EngineTracePlayer::playTrace(EngineController *game, const std::string &sav
 void EngineTracePlayer::prepareTrace(EngineController *game, const std::string &savePath, const std::string &tracePath) {
     assert(!_trace);
 
-    std::unique_ptr<EventTrace> trace = std::make_unique<EventTrace>(EventTrace::loadFromFile(tracePath, application()->window()));
+    // Only the header is read here, events are read lazily during playback.
+    std::unique_ptr<EventTraceReader> trace = std::make_unique<EventTraceReader>(tracePath, application()->window());
 
     int saveFileSize = std::filesystem::file_size(savePath);
-    if (trace->header.saveFileSize != -1 && trace->header.saveFileSize != saveFileSize) {
+    if (trace->header().saveFileSize != -1 && trace->header().saveFileSize != saveFileSize) {
         throw Exception("Trace '{}' expected a savegame of size {} bytes, but the size of '{}' is {} bytes",
-                        tracePath, trace->header.saveFileSize, savePath, saveFileSize);
+                        tracePath, trace->header().saveFileSize, savePath, saveFileSize);
     }
 
     game->resizeWindow(640, 480);
     game->tick();
 
-    EngineTraceStateAccessor::patchConfig(engine->config.get(), trace->header.config);
+    EngineTraceStateAccessor::patchConfig(engine->config.get(), trace->header().config);
     int frameTimeMs = engine->config->debug.TraceFrameTimeMs.value();
 
     _deterministicComponent->startDeterministicSegment(frameTimeMs);
@@ -69,14 +71,19 @@ void EngineTracePlayer::playPreparedTrace(EngineController *game, EngineTracePla
 
     MM_AT_SCOPE_EXIT({
         _deterministicComponent->finish();
+        render->presentationSkipped = false;
         _trace.reset();
         _tracePath.clear();
     });
 
-    checkState(flags, _trace->header.startState, true);
+    checkState(flags, _trace->header().startState, true);
 
-    for (std::unique_ptr<PlatformEvent> &event : _trace->events) {
+    int frame = 0;
+    while (std::unique_ptr<PlatformEvent> event = _trace->next()) {
         if (event->type == EVENT_PAINT) {
+            // Game thread is paused between ticks, so it's safe to poke the renderer from here.
+            if (flags & TRACE_PLAYBACK_FAST_FORWARD)
+                render->presentationSkipped = ++frame % _fastForwardInterval != 0;
             game->tick(1);
 
             const PaintEvent *paintEvent = static_cast<const PaintEvent *>(event.get());
@@ -87,7 +94,7 @@ void EngineTracePlayer::playPreparedTrace(EngineController *game, EngineTracePla
         }
     }
 
-    checkState(flags, _trace->header.endState, false);
+    checkState(flags, _trace->header().endState, false);
 }
 
 void EngineTracePlayer::checkTime(EngineTracePlaybackFlags flags, const PaintEvent *paintEvent) {
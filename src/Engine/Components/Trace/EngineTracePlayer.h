@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cassert>
 #include <string>
 #include <functional>
 #include <memory>
@@ -13,7 +14,7 @@
 class EngineController;
 class EngineDeterministicComponent;
 class GameKeyboardController;
-class EventTrace;
+class EventTraceReader;
 class EventTraceGameState;
 class PaintEvent;
 
@@ -49,6 +50,16 @@ class EngineTracePlayer : private PlatformApplicationAware {
     void prepareTrace(EngineController *game, const std::string &savePath, const std::string &tracePath);
     void playPreparedTrace(EngineController *game, EngineTracePlaybackFlags flags = 0);
 
+    /**
+     * @param interval                  Every how many frames a frame is actually presented when playing back with
+     *                                  `TRACE_PLAYBACK_FAST_FORWARD`. Skipped frames still run all of the game logic,
+     *                                  so this doesn't affect the playback results.
+     */
+    void setFastForwardInterval(int interval) {
+        assert(interval > 0);
+        _fastForwardInterval = interval;
+    }
+
  private:
     friend class PlatformIntrospection;
 
@@ -61,7 +72,8 @@ class EngineTracePlayer : private PlatformApplicationAware {
 
  private:
     std::string _tracePath;
-    std::unique_ptr<EventTrace> _trace;
+    std::unique_ptr<EventTraceReader> _trace;
     EngineDeterministicComponent *_deterministicComponent = nullptr;
     GameKeyboardController *_keyboardController = nullptr;
+    int _fastForwardInterval = 32;
 };
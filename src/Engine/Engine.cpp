@@ -1,4 +1,12 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -52,7 +60,14 @@
 #include "Media/Audio/AudioPlayer.h"
 #include "Media/MediaPlayer.h"
 
+#include "Library/Profiler/Profiler.h"
 #include "Library/Random/Random.h"
+#include "Library/Snapshot/SnapshotChecksum.h"
+#include "Library/Snapshot/SnapshotReader.h"
+#include "Library/Snapshot/SnapshotWriter.h"
+
+#include "Utility/TaskGraph.h"
+#include "Utility/ThreadPool.h"
 
 using Graphics::IRenderFactory;
 
@@ -107,6 +122,11 @@ void Engine_DeinitializeAndTerminate(int exitCode) {
 
 //----- (0044103C) --------------------------------------------------------
 void Engine::Draw() {
+    MM_PROFILE_ZONE("Engine::Draw");
+
+    assets->uploadCompletedTextures(config->graphics.AsyncTextureUploadBudget.value());
+    PollPendingSave();
+
     engine->SetSaturateFaces(pParty->_497FC5_check_party_perception_against_level());
 
     pCamera3D->_viewPitch = pParty->_viewPitch;
@@ -296,6 +316,39 @@ void Engine::DrawGUI() {
 
         pPrimaryWindow->DrawText(pFontArrus, {16, debug_info_offset + 16 + 16}, colorTable.White.c16(), floor_level_str, 0, 0, 0);
     }
+
+    if (engine->config->debug.Profiler.value())
+        DrawProfilerOverlay();
+}
+
+void Engine::DrawProfilerOverlay() {
+    std::vector<ProfilerZoneStats> stats = Profiler::stats(1'000'000'000);
+
+    // Timings are averaged over the frames from the last second.
+    int64_t frames = 1;
+    for (const ProfilerZoneStats &zone : stats)
+        if (std::string_view(zone.name) == "Frame")
+            frames = std::max<int64_t>(zone.count, 1);
+
+    // Line of sight cache counters are accumulated since startup.
+    const LineOfSightCacheStats &lineOfSight = GetLineOfSightCacheStats();
+    int y = 96;
+    pPrimaryWindow->DrawText(pFontArrus, {16, y}, colorTable.White.c16(),
+                             fmt::format("Line of sight cache, {} hits, {} misses, {} invalidations", lineOfSight.hits,
+                                         lineOfSight.misses, lineOfSight.invalidations), 0, 0, 0);
+
+    y += 16;
+    pPrimaryWindow->DrawText(pFontArrus, {16, y}, colorTable.White.c16(),
+                             fmt::format("Profiler, {} frames, ms/frame, max ms, calls/frame:", frames), 0, 0, 0);
+    for (const ProfilerZoneStats &zone : stats) {
+        if (y >= 320)
+            break; // Don't draw over the bottom UI.
+
+        y += 16;
+        pPrimaryWindow->DrawText(pFontArrus, {16, y}, colorTable.White.c16(),
+                                 fmt::format("{:.2f} {:.2f} {:.1f} {}", zone.totalNs / 1e6 / frames, zone.maxNs / 1e6,
+                                             static_cast<double>(zone.count) / frames, zone.name), 0, 0, 0);
+    }
 }
 
 //----- (0047A815) --------------------------------------------------------
@@ -462,6 +515,7 @@ void Engine::Deinitialize() {
     if (pNPCStats)
         pNPCStats->Release();
 
+    WaitForPendingSave();
     if (pSave_LOD)
         pSave_LOD->FreeSubIndexAndIO();
 
@@ -588,6 +642,7 @@ Engine::Engine(std::shared_ptr<GameConfig> config) {
     this->mouse = EngineIocContainer::ResolveMouse();
     this->nuklear = EngineIocContainer::ResolveNuklear();
     this->particle_engine = EngineIocContainer::ResolveParticleEngine();
+    this->particle_engine->setCapacity(config->graphics.ParticleLimit.value());
     this->vis = EngineIocContainer::ResolveVis();
 
     uNumStationaryLights = 0;
@@ -739,6 +794,8 @@ void PlayButtonClickSound() {
 
 //----- (0046BDC0) --------------------------------------------------------
 void UpdateUserInput_and_MapSpecificStuff() {
+    MM_PROFILE_ZONE("UpdateUserInput_and_MapSpecificStuff");
+
     if (dword_6BE364_game_settings_1 & GAME_SETTINGS_0080_SKIP_USER_INPUT_THIS_FRAME) {
         dword_6BE364_game_settings_1 &= ~GAME_SETTINGS_0080_SKIP_USER_INPUT_THIS_FRAME;
         return;
@@ -813,8 +870,8 @@ void DoPrepareWorld(bool bLoading, int _1_fullscreen_loading_2_box) {
     bDialogueUI_InitializeActor_NPC_ID = 0;
     onMapLoad();
     pGameLoadingUI_ProgressBar->Progress();
-    memset(&render->pBillboardRenderListD3D, 0,
-           sizeof(render->pBillboardRenderListD3D));
+    render->pBillboardRenderListD3D.clear();
+    render->uNumBillboardsToDraw = 0;
     pGameLoadingUI_ProgressBar->Release();
 }
 
@@ -834,6 +891,56 @@ void FinalInitialization() {
     pIcons_LOD->_inlined_sub1();
 }
 
+static std::shared_ptr<SnapshotWriter> startupSnapshotWriter;
+
+/**
+ * Attaches a startup snapshot to the events LOD. If there is an up-to-date snapshot on disk, LOD reads are served
+ * from it. Otherwise all reads are recorded until the end of `Engine::SecondaryInitialization`, and a new snapshot is
+ * written out then, see `saveStartupSnapshot`.
+ *
+ * Snapshots are fingerprinted with the LOD's size & modification time, so replacing the LOD invalidates the snapshot.
+ */
+static void attachStartupSnapshot() {
+    std::string lodPath = MakeDataPath("data", "events.lod");
+    std::string snapshotPath = MakeDataPath("data", "events.snapshot");
+
+    std::error_code ec;
+    uint64_t fingerprint[2] = {std::filesystem::file_size(lodPath, ec), 0};
+    if (!ec)
+        fingerprint[1] = std::filesystem::last_write_time(lodPath, ec).time_since_epoch().count();
+    if (ec) {
+        logger->warning("Startup snapshot: couldn't stat '{}': {}", lodPath, ec.message());
+        return;
+    }
+    uint64_t checksum = snapshotChecksum(fingerprint, sizeof(fingerprint));
+
+    std::shared_ptr<const SnapshotReader> reader = SnapshotReader::open(snapshotPath, checksum);
+    if (reader) {
+        logger->info("Startup snapshot: using '{}' with {} entries", snapshotPath, reader->size());
+        pEvents_LOD->SetSnapshot(std::move(reader), nullptr);
+    } else {
+        logger->info("Startup snapshot: '{}' is missing or stale, recording a new one", snapshotPath);
+        startupSnapshotWriter = std::make_shared<SnapshotWriter>(checksum);
+        pEvents_LOD->SetSnapshot(nullptr, startupSnapshotWriter);
+    }
+}
+
+static void saveStartupSnapshot() {
+    if (!startupSnapshotWriter)
+        return;
+
+    pEvents_LOD->SetSnapshot(nullptr, nullptr);
+
+    std::string snapshotPath = MakeDataPath("data", "events.snapshot");
+    try {
+        startupSnapshotWriter->write(snapshotPath);
+        logger->info("Startup snapshot: saved '{}'", snapshotPath);
+    } catch (const std::exception &e) {
+        logger->warning("Startup snapshot: couldn't save '{}': {}", snapshotPath, e.what());
+    }
+    startupSnapshotWriter.reset();
+}
+
 bool MM7_LoadLods() {
     pIcons_LOD = new LODFile_IconsBitmaps;
     if (!pIcons_LOD->Load(MakeDataPath("data", "icons.lod"), "icons")) {
@@ -847,6 +954,8 @@ bool MM7_LoadLods() {
         Error("Some files are missing\n\nPlease Reinstall.");
         return false;
     }
+    if (engine->config->settings.StartupSnapshot.value())
+        attachStartupSnapshot();
 
     pBitmaps_LOD = new LODFile_IconsBitmaps;
     if (!pBitmaps_LOD->Load(MakeDataPath("data", "bitmaps.lod"), "bitmaps")) {
@@ -871,6 +980,35 @@ bool MM7_LoadLods() {
     return true;
 }
 
+/**
+ * Adds tasks for loading a data table from the events LOD (and icons LOD from MM6, if present) to the provided task
+ * graph.
+ *
+ * `LOD::File` reads go through a shared `FILE` handle, so reads are chained one after another in the graph, and only
+ * deserialization runs in parallel.
+ *
+ * @param graph                         Task graph to add tasks to.
+ * @param[in,out] lastRead              Id of the last LOD read task in the graph, if any.
+ * @param fileName                      Data table file name.
+ * @param table                         Data table to load.
+ */
+template<class Table>
+static void addDataTableTasks(TaskGraph *graph, std::vector<TaskGraph::TaskId> *lastRead, const std::string &fileName, Table *table) {
+    auto blobs = std::make_shared<std::array<Blob, 2>>();
+
+    TaskGraph::TaskId read = graph->add(fileName + " (read)", [blobs, fileName] {
+        (*blobs)[0] = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture(fileName) : Blob();
+        (*blobs)[1] = pEvents_LOD->LoadCompressedTexture(fileName);
+    }, *lastRead);
+
+    graph->add(fileName + " (parse)", [blobs, table] {
+        table->FromFile((*blobs)[0], (*blobs)[1], Blob());
+        *blobs = {};
+    }, {read});
+
+    *lastRead = {read};
+}
+
 //----- (004651F4) --------------------------------------------------------
 bool Engine::MM7_Initialize() {
     grng->seed(platform->tickCount());
@@ -895,72 +1033,41 @@ bool Engine::MM7_Initialize() {
     localization = new Localization();
     localization->Initialize();
 
+    pSpriteFrameTable = new SpriteFrameTable;
+    pTextureFrameTable = new TextureFrameTable;
+    pTileTable = new TileTable;
+    pPlayerFrameTable = new PlayerFrameTable;
+    pIconsFrameTable = new IconFrameTable;
+    pDecorationList = new DecorationList;
+    pObjectList = new ObjectList;
+    pMonsterList = new MonsterList;
+    pChestList = new ChestList;
+    pOverlayList = new OverlayList;
+    pSoundList = new SoundList;
+
     {
-        Blob sft_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dsft.bin") : Blob();
-        Blob sft_mm8;
-        Blob sft_mm7 = pEvents_LOD->LoadCompressedTexture("dsft.bin");
-        pSpriteFrameTable = new SpriteFrameTable;
-        pSpriteFrameTable->FromFile(sft_mm6, sft_mm7, sft_mm8);
-
-        Blob tft_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dtft.bin") : Blob();
-        Blob tft_mm8;
-        Blob tft_mm7 = pEvents_LOD->LoadCompressedTexture("dtft.bin");
-        pTextureFrameTable = new TextureFrameTable;
-        pTextureFrameTable->FromFile(tft_mm6, tft_mm7, tft_mm8);
-
-        Blob tiles_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dtile.bin") : Blob();
-        Blob tiles_mm8;
-        Blob tiles_mm7 = pEvents_LOD->LoadCompressedTexture("dtile.bin");
-        pTileTable = new TileTable;
-        pTileTable->FromFile(tiles_mm6, tiles_mm7, tiles_mm8);
-
-        Blob pft_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dpft.bin") : Blob();
-        Blob pft_mm8;
-        Blob pft_mm7 = pEvents_LOD->LoadCompressedTexture("dpft.bin");
-        pPlayerFrameTable = new PlayerFrameTable;
-        pPlayerFrameTable->FromFile(pft_mm6, pft_mm7, pft_mm8);
-
-        Blob ift_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dift.bin") : Blob();
-        Blob ift_mm8;
-        Blob ift_mm7 = pEvents_LOD->LoadCompressedTexture("dift.bin");
-        pIconsFrameTable = new IconFrameTable;
-        pIconsFrameTable->FromFile(ift_mm6, ift_mm7, ift_mm8);
-
-        Blob decs_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("ddeclist.bin") : Blob();
-        Blob decs_mm8;
-        Blob decs_mm7 = pEvents_LOD->LoadCompressedTexture("ddeclist.bin");
-        pDecorationList = new DecorationList;
-        pDecorationList->FromFile(decs_mm6, decs_mm7, decs_mm8);
-
-        Blob objs_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dobjlist.bin") : Blob();
-        Blob objs_mm8;
-        Blob objs_mm7 = pEvents_LOD->LoadCompressedTexture("dobjlist.bin");
-        pObjectList = new ObjectList;
-        pObjectList->FromFile(objs_mm6, objs_mm7, objs_mm8);
-
-        Blob mons_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dmonlist.bin") : Blob();
-        Blob mons_mm8;
-        Blob mons_mm7 = pEvents_LOD->LoadCompressedTexture("dmonlist.bin");
-        pMonsterList = new MonsterList;
-        pMonsterList->FromFile(mons_mm6, mons_mm7, mons_mm8);
-
-        Blob chests_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dchest.bin") : Blob();
-        Blob chests_mm8;
-        Blob chests_mm7 = pEvents_LOD->LoadCompressedTexture("dchest.bin");
-        pChestList = new ChestList;
-        pChestList->FromFile(chests_mm6, chests_mm7, chests_mm8);
-
-        Blob overlays_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("doverlay.bin") : Blob();
-        Blob overlays_mm8;
-        Blob overlays_mm7 = pEvents_LOD->LoadCompressedTexture("doverlay.bin");
-        pOverlayList = new OverlayList;
-        pOverlayList->FromFile(overlays_mm6, overlays_mm7, overlays_mm8);
-
-        Blob sounds_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dsounds.bin") : Blob();
-        Blob sounds_mm8;
-        Blob sounds_mm7 = pEvents_LOD->LoadCompressedTexture("dsounds.bin");
-        pSoundList = new SoundList;
-        pSoundList->FromFile(sounds_mm6, sounds_mm7, sounds_mm8);
+        TaskGraph graph;
+        std::vector<TaskGraph::TaskId> lastRead;
+        addDataTableTasks(&graph, &lastRead, "dsft.bin", pSpriteFrameTable);
+        addDataTableTasks(&graph, &lastRead, "dtft.bin", pTextureFrameTable);
+        addDataTableTasks(&graph, &lastRead, "dtile.bin", pTileTable);
+        addDataTableTasks(&graph, &lastRead, "dpft.bin", pPlayerFrameTable);
+        addDataTableTasks(&graph, &lastRead, "dift.bin", pIconsFrameTable);
+        addDataTableTasks(&graph, &lastRead, "ddeclist.bin", pDecorationList);
+        addDataTableTasks(&graph, &lastRead, "dobjlist.bin", pObjectList);
+        addDataTableTasks(&graph, &lastRead, "dmonlist.bin", pMonsterList);
+        addDataTableTasks(&graph, &lastRead, "dchest.bin", pChestList);
+        addDataTableTasks(&graph, &lastRead, "doverlay.bin", pOverlayList);
+        addDataTableTasks(&graph, &lastRead, "dsounds.bin", pSoundList);
+
+        ThreadPool pool;
+        auto startTime = std::chrono::steady_clock::now();
+        graph.run(pool);
+        auto totalTime = std::chrono::steady_clock::now() - startTime;
+
+        for (const TaskGraph::TaskTiming &timing : graph.timings())
+            logger->info("Data tables: {} took {}us", timing.name, std::chrono::duration_cast<std::chrono::microseconds>(timing.duration).count());
+        logger->info("Data tables: loaded in {}us", std::chrono::duration_cast<std::chrono::microseconds>(totalTime).count());
     }
 
     if (!config->debug.NoSound.value())
@@ -1036,6 +1143,8 @@ void Engine::SecondaryInitialization() {
     pSprites_LOD->_inlined_sub0();
 
     Initialize_GamesLOD_NewLOD();
+
+    saveStartupSnapshot();
 }
 
 void Engine::Initialize() {
@@ -1133,6 +1242,7 @@ void PrepareToLoadODM(bool bLoading, ODMRenderParams *a2) {
 
     viewparams->_443365();
     PlayLevelMusic();
+    PrewarmLevelSounds();
 
     //  level decoration sound
     for (int decorIdx : decorationsWithSound) {
@@ -1352,6 +1462,7 @@ void setTexture(unsigned int uFaceCog, const std::string &pFilename) {
 
 void setFacesBit(int sCogNumber, FaceAttribute bit, int on) {
     if (sCogNumber) {
+        InvalidateLineOfSightCache();
         if (uCurrentlyLoadedLevelType == LEVEL_Indoor) {
             for (uint i = 1; i < (unsigned int)pIndoor->pFaceExtras.size(); ++i) {
                 if (pIndoor->pFaceExtras[i].sCogNumber == sCogNumber) {
@@ -122,6 +122,7 @@ class Engine {
     void DrawParticles();
     void Draw();
     void DrawGUI();
+    void DrawProfilerOverlay();
     void ResetCursor_Palettes_LODs_Level_Audio_SFT_Windows();
     void SecondaryInitialization();
     void _461103_load_level_sub();
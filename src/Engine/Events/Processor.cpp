@@ -15,6 +15,8 @@
 #include "Engine/Party.h"
 #include "GUI/UI/UIStatusBar.h"
 
+#include "Library/Profiler/Profiler.h"
+
 struct MapTimer {
     GameTime interval = GameTime(0);
     GameTime timeInsideDay = GameTime(0);
@@ -242,6 +244,8 @@ static void checkTimer(MapTimer &timer) {
 }
 
 void onTimer() {
+    MM_PROFILE_ZONE("onTimer");
+
     if (pEventTimer->bPaused) {
         return;
     }
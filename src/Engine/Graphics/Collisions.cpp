@@ -2,23 +2,43 @@
 
 #include <algorithm>
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include "Engine/Events/Processor.h"
 #include "Engine/Graphics/DecorationList.h"
 #include "Engine/Graphics/Level/Decoration.h"
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/SpatialGrid.h"
 #include "Engine/MM7.h"
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/TurnEngine/TurnEngine.h"
 
+#include "Library/Profiler/Profiler.h"
+
+#include "Utility/Geometry/BBoxTree.h"
 #include "Utility/Math/Float.h"
 #include "Utility/Math/TrigLut.h"
 
 CollisionState collision_state;
 
+/**
+ * Outdoor model face, pre-converted for collision checks.
+ */
+struct OutdoorCollisionFace {
+    BLVFace face;
+    const ODMFace *source = nullptr; // Face attributes can change at runtime, so they are synced from the source.
+    BBoxi modelBounding;
+    int modelIndex = 0;
+    int pid = 0;
+};
+
+static std::vector<OutdoorCollisionFace> outdoorCollisionFaces; // All faces of all outdoor models, in model order.
+static BBoxTree outdoorCollisionTree; // Built over the bounding boxes of outdoorCollisionFaces.
+
 //
 // Helper functions.
 //
@@ -326,32 +346,56 @@ void CollideIndoorWithGeometry(bool ignore_ethereal) {
     }
 }
 
-void CollideOutdoorWithModels(bool ignore_ethereal) {
-    for (BSPModel &model : pOutdoor->pBModels) {
-        if (!collision_state.bbox.intersects(model.pBoundingBox))
-            continue;
+void PrepareOutdoorCollisions() {
+    outdoorCollisionFaces.clear();
 
+    std::vector<BBoxf> boxes;
+    for (BSPModel &model : pOutdoor->pBModels) {
         for (ODMFace &mface : model.pFaces) {
-            if (!collision_state.bbox.intersects(mface.pBoundingBox))
-                continue;
+            OutdoorCollisionFace &record = outdoorCollisionFaces.emplace_back();
+            record.face.facePlane = mface.facePlane;
+            record.face.uAttributes = mface.uAttributes;
+            record.face.pBounding = mface.pBoundingBox;
+            record.face.zCalc = mface.zCalc;
+            record.face.uPolygonType = (PolygonType)mface.uPolygonType;
+            record.face.uNumVertices = mface.uNumVertices;
+            record.face.resource = mface.resource;
+            record.face.pVertexIDs = mface.pVertexIDs.data();
+            record.source = &mface;
+            record.modelBounding = model.pBoundingBox;
+            record.modelIndex = model.index;
+            record.pid = PID(OBJECT_Face, (mface.index | (model.index << 6)));
+
+            BBoxf &box = boxes.emplace_back();
+            box.x1 = mface.pBoundingBox.x1;
+            box.x2 = mface.pBoundingBox.x2;
+            box.y1 = mface.pBoundingBox.y1;
+            box.y2 = mface.pBoundingBox.y2;
+            box.z1 = mface.pBoundingBox.z1;
+            box.z2 = mface.pBoundingBox.z2;
+        }
+    }
 
-            // TODO: we should really either merge two face classes, or template the functions down the chain call here.
-            BLVFace face;
-            face.facePlane = mface.facePlane;
-            face.uAttributes = mface.uAttributes;
-            face.pBounding = mface.pBoundingBox;
-            face.zCalc = mface.zCalc;
-            face.uPolygonType = (PolygonType)mface.uPolygonType;
-            face.uNumVertices = mface.uNumVertices;
-            face.resource = mface.resource;
-            face.pVertexIDs = mface.pVertexIDs.data();
-
-            if (face.Ethereal() || face.Portal()) // TODO: this doesn't respect ignore_ethereal parameter
-                continue;
+    outdoorCollisionTree = BBoxTree(std::move(boxes));
+}
 
-            int pid = PID(OBJECT_Face, (mface.index | (model.index << 6)));
-            CollideBodyWithFace(&face, pid, ignore_ethereal, model.index);
-        }
+void CollideOutdoorWithModels(bool ignore_ethereal) {
+    static std::vector<int> candidates;
+    outdoorCollisionTree.query(collision_state.bbox, &candidates);
+
+    // Faces are checked in model order so that ties are resolved in the same way as before the tree was introduced.
+    std::sort(candidates.begin(), candidates.end());
+
+    for (int index : candidates) {
+        OutdoorCollisionFace &record = outdoorCollisionFaces[index];
+        if (!collision_state.bbox.intersects(record.modelBounding))
+            continue;
+
+        record.face.uAttributes = record.source->uAttributes;
+        if (record.face.Ethereal() || record.face.Portal()) // TODO: this doesn't respect ignore_ethereal parameter
+            continue;
+
+        CollideBodyWithFace(&record.face, record.pid, ignore_ethereal, record.modelIndex);
     }
 }
 
@@ -427,7 +471,10 @@ bool CollideWithActor(int actor_idx, int override_radius) {
 }
 
 void _46ED8A_collide_against_sprite_objects(unsigned int pid) {
-    for (uint i = 0; i < pSpriteObjects.size(); ++i) {
+    static std::vector<int> candidates;
+    FindSpriteObjectsNear(collision_state.bbox, &candidates);
+
+    for (int i : candidates) {
         if (pSpriteObjects[i].uObjectDescID == 0)
             continue;
 
@@ -475,6 +522,8 @@ void CollideWithParty(bool jagged_top) {
 }
 
 void ProcessActorCollisionsBLV(Actor &actor, bool isAboveGround, bool isFlying) {
+    MM_PROFILE_ZONE("ProcessActorCollisionsBLV");
+
     collision_state.ignored_face_id = -1;
     collision_state.total_move_distance = 0;
     collision_state.check_hi = true;
@@ -608,9 +657,13 @@ void ProcessActorCollisionsBLV(Actor &actor, bool isAboveGround, bool isFlying)
         actor.vVelocity.y = fixpoint_mul(58500, actor.vVelocity.y);
         actor.vVelocity.z = fixpoint_mul(58500, actor.vVelocity.z);
     }
+
+    UpdateActorInSpatialGrid(actor.id);
 }
 
 void ProcessActorCollisionsODM(Actor &actor, bool isFlying) {
+    MM_PROFILE_ZONE("ProcessActorCollisionsODM");
+
     int actorRadius = !isFlying ? 40 : actor.uActorRadius;
 
     collision_state.ignored_face_id = -1;
@@ -731,4 +784,6 @@ void ProcessActorCollisionsODM(Actor &actor, bool isFlying) {
         actor.vVelocity.y = fixpoint_mul(58500, actor.vVelocity.y);
         actor.vVelocity.z = fixpoint_mul(58500, actor.vVelocity.z);
     }
+
+    UpdateActorInSpatialGrid(actor.id);
 }
@@ -50,6 +50,12 @@ extern CollisionState collision_state;
  */
 void CollideIndoorWithGeometry(bool ignore_ethereal);
 
+/**
+ * Rebuilds the data used by `CollideOutdoorWithModels` from the models of the currently loaded outdoor location.
+ * Must be called whenever `pOutdoor->pBModels` changes.
+ */
+void PrepareOutdoorCollisions();
+
 /**
  * @offset 0x0046E889.
  *
@@ -196,7 +196,6 @@ class IRender {
         uFogColor = 0;
         memset(pHDWaterBitmapIDs, 0, sizeof(pHDWaterBitmapIDs));
         hd_water_current_frame = 0;
-        memset(pBillboardRenderListD3D, 0, sizeof(pBillboardRenderListD3D));
         uNumBillboardsToDraw = 0;
         drawcalls = 0;
     }
@@ -369,11 +368,22 @@ class IRender {
     unsigned int pHDWaterBitmapIDs[7];
     int hd_water_current_frame;
     Texture *hd_water_tile_anim[7];
-    RenderBillboardD3D pBillboardRenderListD3D[1000];
+    /**
+     * Billboards to draw this frame, only the first `uNumBillboardsToDraw` entries are valid. Billboards are appended
+     * in arbitrary order and sorted by `z_order` once per frame, right before they are drawn. The list only ever
+     * grows, so that the entries can be reused between frames without reallocating.
+     */
+    std::vector<RenderBillboardD3D> pBillboardRenderListD3D;
     unsigned int uNumBillboardsToDraw;
 
     int drawcalls;
 
+    /**
+     * When set, the renderer skips all GPU work, but still updates everything that's observable from the game logic,
+     * like the billboard list, z-buffer, or face visibility flags. Used to fast-forward trace playback.
+     */
+    bool presentationSkipped = false;
+
     Logger *log = nullptr;
     DecalBuilder *decal_builder = nullptr;
     SpellFxRenderer *spell_fx_renderer = nullptr;
@@ -388,8 +398,16 @@ class IRender {
 extern std::shared_ptr<IRender> render;
 
 extern int uNumDecorationsDrawnThisFrame;
-extern RenderBillboard pBillboardRenderList[500];
+extern std::vector<RenderBillboard> pBillboardRenderList; // Only the first `uNumBillboardsToDraw` entries are valid.
 extern unsigned int uNumBillboardsToDraw;
+
+/**
+ * Appends a billboard to `pBillboardRenderList`, growing the list if needed. Entries are reused between frames and
+ * are not reset, so the caller is expected to fill in all the fields.
+ *
+ * @return                              New billboard, same as `pBillboardRenderList[uNumBillboardsToDraw - 1]`.
+ */
+RenderBillboard &AddBillboard();
 extern int uNumSpritesDrawnThisFrame;
 
 extern RenderVertexSoft array_507D30[50];
@@ -1,14 +1,13 @@
 #include "Engine/Graphics/IRenderFactory.h"
 
 #include "Engine/EngineIocContainer.h"
+#include "Engine/Graphics/Null/RenderNull.h"
 #include "Engine/Graphics/OpenGL/RenderOpenGL.h"
 
 using Graphics::IRenderFactory;
 
-std::shared_ptr<IRender> IRenderFactory::Create(std::shared_ptr<GameConfig> config) {
-    RendererType rendererType = config->graphics.Renderer.value();
-
-    switch (rendererType) {
+std::shared_ptr<IRender> IRenderFactory::Create(RendererType type, std::shared_ptr<GameConfig> config) {
+    switch (type) {
         case RendererType::OpenGL:
             logger->info("Initializing OpenGL renderer...");
             return std::make_shared<RenderOpenGL>(
@@ -31,6 +30,17 @@ std::shared_ptr<IRender> IRenderFactory::Create(std::shared_ptr<GameConfig> conf
                 EngineIocContainer::ResolveLogger()
             );
 
+        case RendererType::Null:
+            logger->info("Initializing null renderer...");
+            return std::make_shared<RenderNull>(
+                config,
+                EngineIocContainer::ResolveDecalBuilder(),
+                EngineIocContainer::ResolveSpellFxRenderer(),
+                EngineIocContainer::ResolveParticleEngine(),
+                EngineIocContainer::ResolveVis(),
+                EngineIocContainer::ResolveLogger()
+            );
+
         default:
             return nullptr;
     }
@@ -1,7 +1,9 @@
 #include "Engine/Graphics/Image.h"
 
 #include <algorithm>
+#include <chrono>
 
+#include "Engine/AssetsManager.h"
 #include "Engine/Engine.h"
 
 #include "Engine/Graphics/ImageFormatConverter.h"
@@ -12,6 +14,8 @@
 
 #include "Library/Serialization/EnumSerialization.h"
 
+#include "Utility/ThreadPool.h"
+
 
 struct TextureFrameTable *pTextureFrameTable;
 
@@ -150,14 +154,72 @@ Image *Image::Create(ImageLoader *loader) {
     return img;
 }
 
+Image::~Image() {
+    // Images are normally destroyed through Release, which frees the pixels first. This covers the images that are
+    // deleted directly. Palettes of the async loaders point into LOD data, so only the pixels are freed, same as in
+    // Release.
+    LoadResult result = CancelAsyncLoad();
+    if (result.loaded && result.format != IMAGE_INVALID_FORMAT)
+        delete[] static_cast<uint8_t *>(result.pixels);
+    delete loader;
+    for (void *ptr : pixels)
+        delete[] static_cast<uint8_t *>(ptr);
+}
+
+Image::LoadResult Image::CancelAsyncLoad() {
+    if (!async_result.valid())
+        return {};
+
+    if (assets)
+        assets->cancelAsyncLoad(this);
+
+    // Background load references the loader, so we have to wait for it to finish.
+    return async_result.get();
+}
+
+bool Image::StartAsyncLoad(ThreadPool *pool) {
+    if (initialized || async_result.valid() || !loader || !loader->PrepareAsyncLoad())
+        return false;
+
+    async_result = pool->run([loader = loader] {
+        LoadResult result;
+        result.loaded = loader->Load(&result.width, &result.height, &result.pixels, &result.format,
+                                     &result.palette, &result.palettepixels);
+        return result;
+    });
+    return true;
+}
+
+bool Image::IsAsyncLoadFinished() const {
+    return async_result.valid() && async_result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void Image::WaitForAsyncLoad() const {
+    if (async_result.valid())
+        async_result.wait();
+}
+
+Image::LoadResult Image::RunLoader() {
+    if (async_result.valid())
+        return async_result.get();
+
+    LoadResult result;
+    result.loaded = loader->Load(&result.width, &result.height, &result.pixels, &result.format,
+                                 &result.palette, &result.palettepixels);
+    return result;
+}
+
 bool Image::LoadImageData() {
     if (!initialized) {
-        void *data = nullptr;
-        void *palette = nullptr;
-        initialized = loader->Load(&width, &height, &data, &native_format, &palette);
+        LoadResult result = RunLoader();
+        width = result.width;
+        height = result.height;
+        native_format = result.format;
+        initialized = result.loaded;
         if (initialized && native_format != IMAGE_INVALID_FORMAT) {
-            pixels[native_format] = data;
-            palette24 = palette;
+            pixels[native_format] = result.pixels;
+            palette24 = result.palette;
+            palettepixels = result.palettepixels;
         }
     }
 
@@ -358,6 +420,15 @@ bool Image::Release() {
                 assets->releaseBitmap(loader->GetResourceName());
     }
 
+    if (async_result.valid()) {
+        // Take ownership of the decoded pixels so that they're freed below.
+        LoadResult result = CancelAsyncLoad();
+        if (result.loaded && result.format != IMAGE_INVALID_FORMAT) {
+            pixels[result.format] = result.pixels;
+            initialized = true;
+        }
+    }
+
     if (initialized) {
         if (loader) {
             delete loader;
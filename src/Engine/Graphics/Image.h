@@ -1,5 +1,6 @@
 #pragma once
 
+#include <future>
 #include <string>
 #include <vector>
 
@@ -22,10 +23,11 @@ using enum IMAGE_FORMAT;
 unsigned int IMAGE_FORMAT_BytesPerPixel(IMAGE_FORMAT format);
 
 class ImageLoader;
+class ThreadPool;
 class Image {
  public:
     explicit Image(bool lazy_initialization = true): lazy_initialization(lazy_initialization) {}
-    virtual ~Image() {}
+    virtual ~Image();
 
     static Image *Create(unsigned int width, unsigned int height,
                          IMAGE_FORMAT format, const void *pixels = nullptr);
@@ -42,7 +44,55 @@ class Image {
 
     bool Release();
 
+    /**
+     * Starts loading this image on a background thread. Only images with loaders that support this
+     * (see `ImageLoader::PrepareAsyncLoad`) can be loaded asynchronously. Must be called from the main thread.
+     *
+     * @param pool                      Thread pool to load the image on.
+     * @return                          Whether the async load was started.
+     */
+    bool StartAsyncLoad(ThreadPool *pool);
+
+    bool IsAsyncLoadPending() const { return async_result.valid(); }
+    bool IsAsyncLoadFinished() const;
+
+    /**
+     * Blocks until the background part of an async load started with `StartAsyncLoad` is done. Doesn't upload
+     * anything, use `CompleteAsyncLoad` for that.
+     */
+    void WaitForAsyncLoad() const;
+
+    /**
+     * Finishes an async load started with `StartAsyncLoad`, blocking if the background part is not done yet.
+     * For GPU textures this is also where the texture gets uploaded.
+     */
+    bool CompleteAsyncLoad() { return LoadImageData(); }
+
  protected:
+    struct LoadResult {
+        bool loaded = false;
+        size_t width = 0;
+        size_t height = 0;
+        void *pixels = nullptr;
+        IMAGE_FORMAT format = IMAGE_INVALID_FORMAT;
+        void *palette = nullptr;
+        void *palettepixels = nullptr;
+    };
+
+    /**
+     * Runs the loader, or picks up the result of an async load if one was started.
+     */
+    LoadResult RunLoader();
+
+    /**
+     * Stops tracking the async load in `AssetsManager` and waits for it to finish, if one was started.
+     *
+     * @return                          Result of the async load, caller takes ownership of the decoded data.
+     */
+    LoadResult CancelAsyncLoad();
+
+    std::future<LoadResult> async_result;
+
     bool lazy_initialization = false;
     bool initialized = false;
     ImageLoader *loader = nullptr;
@@ -346,8 +346,66 @@ static void ProcessTransparentPixel(uint8_t *pixels, uint8_t *palette,
     rgba[3] = 0;
 }
 
+static uint8_t *MakeImageFromBitmap(size_t w, size_t h, uint8_t *paletted_pixels, uint8_t *palette,
+                                    bool haveTransparency) {
+    uint8_t *pixels = new uint8_t[w * h * 4];
+
+    for (size_t y = 0; y < h; y++) {
+        for (size_t x = 0; x < w; x++) {
+            size_t p = y * w + x;
+
+            int pal = paletted_pixels[p];
+            if (haveTransparency && pal == 0) {
+                ProcessTransparentPixel(paletted_pixels, palette, x, y, w, h, &pixels[p * 4]);
+            } else {
+                pixels[p * 4 + 0] = palette[3 * pal + 0];
+                pixels[p * 4 + 1] = palette[3 * pal + 1];
+                pixels[p * 4 + 2] = palette[3 * pal + 2];
+                pixels[p * 4 + 3] = 255;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+bool Bitmaps_LOD_Loader::PrepareAsyncLoad() {
+    if (this->use_hwl)
+        return false; // HWL container is not thread-safe.
+
+    Texture_MM7 *tex = lod->GetTexture(lod->LoadTexture(this->resource_name));
+    if (!tex->paletted_pixels || !tex->pPalette24)
+        return false;
+
+    size_t w = tex->header.uTextureWidth;
+    size_t h = tex->header.uTextureHeight;
+
+    prepared_width = w;
+    prepared_height = h;
+    prepared_transparency = transparentTextures.contains(tex->header.pName);
+    prepared_pixels.assign(tex->paletted_pixels, tex->paletted_pixels + w * h);
+    prepared_palette.assign(tex->pPalette24, tex->pPalette24 + 3 * 256);
+    prepared_palette_source = tex->pPalette24;
+    prepared = true;
+    return true;
+}
+
 bool Bitmaps_LOD_Loader::Load(size_t *width, size_t *height,
                               void **out_pixels, IMAGE_FORMAT *format, void **out_palette, void **out_palettepixels) {
+    if (prepared) {
+        *format = IMAGE_FORMAT_A8B8G8R8;
+        *width = prepared_width;
+        *height = prepared_height;
+        *out_pixels = MakeImageFromBitmap(prepared_width, prepared_height, prepared_pixels.data(),
+                                          prepared_palette.data(), prepared_transparency);
+        *out_palette = prepared_palette_source;
+
+        prepared = false;
+        prepared_pixels = {};
+        prepared_palette = {};
+        return true;
+    }
+
     Texture_MM7 *tex = lod->GetTexture(lod->LoadTexture(this->resource_name));
     int num_pixels = tex->header.uTextureWidth * tex->header.uTextureHeight;
 
@@ -355,32 +413,11 @@ bool Bitmaps_LOD_Loader::Load(size_t *width, size_t *height,
         Assert(tex->paletted_pixels);
         Assert(tex->pPalette24);
 
-        uint8_t *pixels = new uint8_t[num_pixels * 4];
-        size_t w = tex->header.uTextureWidth;
-        size_t h = tex->header.uTextureHeight;
-
-        bool haveTransparency = transparentTextures.contains(tex->header.pName);
-
-        for (size_t y = 0; y < h; y++) {
-            for (size_t x = 0; x < w; x++) {
-                size_t p = y * w + x;
-
-                int pal = tex->paletted_pixels[p];
-                if (haveTransparency && pal == 0) {
-                    ProcessTransparentPixel(tex->paletted_pixels, tex->pPalette24, x, y, w, h, &pixels[p * 4]);
-                } else {
-                    pixels[p * 4 + 0] = tex->pPalette24[3 * pal + 0];
-                    pixels[p * 4 + 1] = tex->pPalette24[3 * pal + 1];
-                    pixels[p * 4 + 2] = tex->pPalette24[3 * pal + 2];
-                    pixels[p * 4 + 3] = 255;
-                }
-            }
-        }
-
         *format = IMAGE_FORMAT_A8B8G8R8;
         *width = tex->header.uTextureWidth;
         *height = tex->header.uTextureHeight;
-        *out_pixels = pixels;
+        *out_pixels = MakeImageFromBitmap(tex->header.uTextureWidth, tex->header.uTextureHeight, tex->paletted_pixels,
+                                          tex->pPalette24, transparentTextures.contains(tex->header.pName));
         *out_palette = tex->pPalette24;
         return true;
     } else {
@@ -411,6 +448,56 @@ bool Bitmaps_LOD_Loader::Load(size_t *width, size_t *height,
     }
 }
 
+static uint8_t *MakeImageFromSprite(size_t w, size_t h, const uint8_t *bitmap) {
+    int numpix = w * h;
+
+    uint8_t *pixels = new uint8_t[numpix * 4];
+    memset(pixels, 0, numpix * 4);
+
+    for (size_t y = 0; y < h; y++) {
+        for (size_t x = 0; x < w; x++) {
+            size_t p = y * w + x;
+            uint8_t bitpix = bitmap[p];
+
+            int r = 0, g = 0, b = 0, a = 0;
+            r = bitpix;
+            g = 0;
+            b = 0;
+
+            if (bitpix == 0) {
+                a = r = g = b = 0;
+            } else {
+                a = 255;
+            }
+
+            pixels[p * 4] = r;
+            pixels[p * 4 + 1] = g;
+            pixels[p * 4 + 2] = b;
+            pixels[p * 4 + 3] = a;
+        }
+    }
+
+    return pixels;
+}
+
+bool Sprites_LOD_Loader::PrepareAsyncLoad() {
+    if (this->use_hwl)
+        return false; // HWL container is not thread-safe.
+
+    Sprite *pSprite = lod->getSprite(this->resource_name);
+    if (!pSprite || !pSprite->sprite_header || !pSprite->sprite_header->bitmap)
+        return false;
+
+    size_t w = pSprite->sprite_header->uWidth;
+    size_t h = pSprite->sprite_header->uHeight;
+
+    prepared_width = w;
+    prepared_height = h;
+    prepared_pixels.assign(pSprite->sprite_header->bitmap, pSprite->sprite_header->bitmap + w * h);
+    prepared = true;
+    return true;
+}
+
 bool Sprites_LOD_Loader::Load(size_t *width, size_t *height,
                               void **out_pixels, IMAGE_FORMAT *format, void **out_palette, void **out_palettepixels) {
     *width = 0;
@@ -419,6 +506,17 @@ bool Sprites_LOD_Loader::Load(size_t *width, size_t *height,
     *out_palette = nullptr;
     *format = IMAGE_INVALID_FORMAT;
 
+    if (prepared) {
+        *format = IMAGE_FORMAT_A8B8G8R8;
+        *width = prepared_width;
+        *height = prepared_height;
+        *out_pixels = MakeImageFromSprite(prepared_width, prepared_height, prepared_pixels.data());
+
+        prepared = false;
+        prepared_pixels = {};
+        return true;
+    }
+
     if (!this->use_hwl) {
         Sprite *pSprite = lod->getSprite(this->resource_name);
         //Assert(thissprite->texture-> tex->paletted_pixels);
@@ -426,38 +524,11 @@ bool Sprites_LOD_Loader::Load(size_t *width, size_t *height,
 
         size_t w = pSprite->sprite_header->uWidth;
         size_t h = pSprite->sprite_header->uHeight;
-        int numpix = w * h;
-
-        uint8_t *pixels = new uint8_t[numpix * 4];
-        memset(pixels, 0, numpix * 4);
-
-        for (size_t y = 0; y < h; y++) {
-            for (size_t x = 0; x < w; x++) {
-                size_t p = y * w + x;
-                uint8_t bitpix = pSprite->sprite_header->bitmap[p];
-
-                int r = 0, g = 0, b = 0, a = 0;
-                r = bitpix;
-                g = 0;
-                b = 0;
-
-                if (bitpix == 0) {
-                    a = r = g = b = 0;
-                } else {
-                    a = 255;
-                }
-
-                pixels[p * 4] = r;
-                pixels[p * 4 + 1] = g;
-                pixels[p * 4 + 2] = b;
-                pixels[p * 4 + 3] = a;
-            }
-        }
 
         *format = IMAGE_FORMAT_A8B8G8R8;
         *width = w;
         *height = h;
-        *out_pixels = pixels;
+        *out_pixels = MakeImageFromSprite(w, h, pSprite->sprite_header->bitmap);
         *out_palette = nullptr;
         return true;
     } else {
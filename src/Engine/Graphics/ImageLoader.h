@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "Engine/LOD.h"
 #include "Engine/EngineIocContainer.h"
@@ -19,6 +21,20 @@ class ImageLoader {
     virtual bool Load(size_t *width, size_t *height, void **pixels,
                       IMAGE_FORMAT *format, void **out_palette, void **out_pallettepixels = nullptr) = 0;
 
+    /**
+     * Prepares this loader for a `Load` call from a background thread. Loaders that support this should do all the
+     * non-thread-safe work (e.g. accessing the LODs) here, and copy out all the data that `Load` will need.
+     *
+     * LOD reads & decompression can't be moved off the main thread as they go through the LOD texture & sprite
+     * caches, which are shared with the rest of the engine. So for the LOD loaders this is where the file is read
+     * and decompressed (if it's not cached already), and only the palette expansion is left for `Load`.
+     *
+     * Called on the main thread.
+     *
+     * @return                          Whether `Load` can now be called from a background thread.
+     */
+    virtual bool PrepareAsyncLoad() { return false; }
+
  protected:
     std::string resource_name;
     Logger *log;
@@ -145,10 +161,20 @@ class Bitmaps_LOD_Loader : public ImageLoader {
 
     virtual bool Load(size_t *width, size_t *height, void **pixels,
                       IMAGE_FORMAT *format, void **out_palette, void **out_pallettepixels = nullptr) override;
+    virtual bool PrepareAsyncLoad() override;
 
  protected:
     LODFile_IconsBitmaps *lod;
     bool use_hwl;
+
+    // Data copied out of the LOD in PrepareAsyncLoad.
+    bool prepared = false;
+    size_t prepared_width = 0;
+    size_t prepared_height = 0;
+    bool prepared_transparency = false;
+    std::vector<uint8_t> prepared_pixels;
+    std::vector<uint8_t> prepared_palette;
+    uint8_t *prepared_palette_source = nullptr;
 };
 
 class Sprites_LOD_Loader : public ImageLoader {
@@ -165,10 +191,17 @@ class Sprites_LOD_Loader : public ImageLoader {
 
     virtual bool Load(size_t *width, size_t *height, void **pixels,
                       IMAGE_FORMAT *format, void **out_palette, void **out_pallettepixels = nullptr) override;
+    virtual bool PrepareAsyncLoad() override;
 
  protected:
     LODFile_Sprites *lod;
     unsigned int palette_id;
     /*refactor*/ unsigned int lod_sprite_id;
     bool use_hwl;
+
+    // Data copied out of the LOD in PrepareAsyncLoad.
+    bool prepared = false;
+    size_t prepared_width = 0;
+    size_t prepared_height = 0;
+    std::vector<uint8_t> prepared_pixels;
 };
@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <unordered_map>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -17,6 +19,7 @@
 #include "Engine/Graphics/Overlays.h"
 #include "Engine/Graphics/PaletteManager.h"
 #include "Engine/Graphics/ParticleEngine.h"
+#include "Engine/Graphics/SpatialGrid.h"
 #include "Engine/Graphics/Texture.h"
 #include "Engine/Graphics/Sprites.h"
 #include "Engine/Graphics/PortalFunctions.h"
@@ -30,6 +33,7 @@
 #include "Engine/Tables/ItemTable.h"
 #include "Engine/OurMath.h"
 #include "Engine/Party.h"
+#include "Engine/SaveLoad.h"
 #include "Engine/Serialization/CompositeImages.h"
 #include "Engine/SpellFxRenderer.h"
 #include "Engine/Time.h"
@@ -42,6 +46,7 @@
 
 #include "Media/Audio/AudioPlayer.h"
 
+#include "Library/Profiler/Profiler.h"
 #include "Library/Random/Random.h"
 
 #include "Utility/Memory/FreeDeleter.h"
@@ -207,6 +212,7 @@ void IndoorLocation::Release() {
     this->pDoors.clear();
     this->pLights.clear();
     this->pMapOutlines.clear();
+    this->sectorGrid.clear();
 
     render->ReleaseBSP();
 
@@ -251,16 +257,22 @@ void IndoorLocation::Load(const std::string &filename, int num_days_played, int
 
     bLoaded = true;
 
-    IndoorLocation_MM7 location;
-    deserialize(pGames_LOD->LoadCompressed(blv_filename), &location);
-    deserialize(location, this);
-
     std::string dlv_filename = filename;
     dlv_filename.replace(dlv_filename.length() - 4, 4, ".dlv");
 
+    // The initial delta is only needed on respawn, but decompressing it alongside the level is nearly free.
+    std::vector<Blob> levelFiles = LoadGamesLodFiles({blv_filename, dlv_filename});
+
+    IndoorLocation_MM7 location;
+    deserialize(levelFiles[0], &location);
+    deserialize(location, this);
+    sectorGrid.build(pSectors, 5);
+    InvalidateLineOfSightCache();
+
     bool respawnInitial = false; // Perform initial location respawn?
     bool respawnTimed = false; // Perform timed location respawn?
     IndoorDelta_MM7 delta;
+    WaitForPendingSave();
     if (Blob blob = pSave_LOD->LoadCompressed(dlv_filename)) {
         try {
             deserialize(blob, &delta, location);
@@ -288,12 +300,12 @@ void IndoorLocation::Load(const std::string &filename, int num_days_played, int
     assert(respawnInitial + respawnTimed <= 1);
 
     if (respawnInitial) {
-        deserialize(pGames_LOD->LoadCompressed(dlv_filename), &delta, location);
+        deserialize(levelFiles[1], &delta, location);
         *indoor_was_respawned = true;
     } else if (respawnTimed) {
         auto header = delta.header;
         auto visibleOutlines = delta.visibleOutlines;
-        deserialize(pGames_LOD->LoadCompressed(dlv_filename), &delta, location);
+        deserialize(levelFiles[1], &delta, location);
         delta.header = header;
         delta.visibleOutlines = visibleOutlines;
         *indoor_was_respawned = true;
@@ -309,6 +321,76 @@ void IndoorLocation::Load(const std::string &filename, int num_days_played, int
         dlv.respawnCount++;
 }
 
+void BLVSectorGrid::build(const std::vector<BLVSector> &sectors, int margin) {
+    clear();
+    if (sectors.size() < 2)
+        return;
+
+    BBoxi bounds;
+    for (size_t i = 1; i < sectors.size(); i++) {
+        const BBoxs &box = sectors[i].pBounding;
+        if (i == 1) {
+            bounds = BBoxi{box.x1, box.x2, box.y1, box.y2, box.z1, box.z2};
+        } else {
+            bounds.x1 = std::min<int>(bounds.x1, box.x1);
+            bounds.x2 = std::max<int>(bounds.x2, box.x2);
+            bounds.y1 = std::min<int>(bounds.y1, box.y1);
+            bounds.y2 = std::max<int>(bounds.y2, box.y2);
+        }
+    }
+
+    // Cells don't need to be small, it's enough for each cell to overlap only a handful of sectors.
+    _x = bounds.x1 - margin;
+    _y = bounds.y1 - margin;
+    int sizeX = bounds.x2 - bounds.x1 + 2 * margin + 1;
+    int sizeY = bounds.y2 - bounds.y1 + 2 * margin + 1;
+    _cellSize = std::max(256, (std::max(sizeX, sizeY) + 63) / 64);
+    _width = (sizeX + _cellSize - 1) / _cellSize;
+    _height = (sizeY + _cellSize - 1) / _cellSize;
+
+    auto forEachCell = [&](const BBoxs &box, auto callback) {
+        int x1 = (box.x1 - margin - _x) / _cellSize;
+        int x2 = (box.x2 + margin - _x) / _cellSize;
+        int y1 = (box.y1 - margin - _y) / _cellSize;
+        int y2 = (box.y2 + margin - _y) / _cellSize;
+        for (int y = y1; y <= y2; y++)
+            for (int x = x1; x <= x2; x++)
+                callback(x + y * _width);
+    };
+
+    // Two passes - first count the sectors in each cell, then fill in the ids.
+    _cellOffsets.assign(_width * _height + 1, 0);
+    for (size_t i = 1; i < sectors.size(); i++)
+        forEachCell(sectors[i].pBounding, [&](int cell) { _cellOffsets[cell + 1]++; });
+    for (size_t i = 1; i < _cellOffsets.size(); i++)
+        _cellOffsets[i] += _cellOffsets[i - 1];
+
+    std::vector<int> positions(_cellOffsets.begin(), _cellOffsets.end() - 1);
+    _sectorIds.resize(_cellOffsets.back());
+    for (size_t i = 1; i < sectors.size(); i++)
+        forEachCell(sectors[i].pBounding, [&](int cell) { _sectorIds[positions[cell]++] = i; });
+}
+
+void BLVSectorGrid::clear() {
+    _width = 0;
+    _height = 0;
+    _cellOffsets.clear();
+    _sectorIds.clear();
+}
+
+std::span<const int> BLVSectorGrid::sectorsAt(int x, int y) const {
+    if (x < _x || y < _y)
+        return {};
+
+    int cellX = (x - _x) / _cellSize;
+    int cellY = (y - _y) / _cellSize;
+    if (cellX >= _width || cellY >= _height)
+        return {};
+
+    int cell = cellX + cellY * _width;
+    return std::span(_sectorIds).subspan(_cellOffsets[cell], _cellOffsets[cell + 1] - _cellOffsets[cell]);
+}
+
 //----- (0049AC17) --------------------------------------------------------
 int IndoorLocation::GetSector(int sX, int sY, int sZ) {
     if (uCurrentlyLoadedLevelType != LEVEL_Indoor) return 0;
@@ -322,8 +404,8 @@ int IndoorLocation::GetSector(int sX, int sY, int sZ) {
     int NumFoundFaceStore = 0;
     int backupboundingsector{ 0 };
 
-    // loop through sectors
-    for (uint i = 1; i < pSectors.size(); ++i) {
+    // loop through sectors, only the ones that can pass the bounding box check below are looked at
+    for (int i : sectorGrid.sectorsAt(sX, sY)) {
         if (NumFoundFaceStore >= 5) break;
 
         BLVSector *pSector = &pSectors[i];
@@ -597,6 +679,9 @@ void BLV_UpdateDoors() {
         }
         bool shouldPlaySound = !(door->uAttributes & (DOOR_SETTING_UP | DOOR_NOSOUND)) && door->uNumVertices != 0;
 
+        // Door geometry is about to change.
+        InvalidateLineOfSightCache();
+
         door->uTimeSinceTriggered += pEventTimer->uTimeElapsed;
 
         int openDistance;     // [sp+60h] [bp-4h]@6
@@ -972,6 +1057,7 @@ void PrepareToLoadBLV(bool bLoading) {
     }
     viewparams->_443365();
     PlayLevelMusic();
+    PrewarmLevelSounds();
 
     // Active character speaks.
     if (!bLoading && indoor_was_respawned) {
@@ -1153,8 +1239,7 @@ void IndoorLocation::PrepareDecorationsRenderList_BLV(unsigned int uDecorationID
             if (projected_x + screen_space_half_width >= (signed int)pViewport->uViewportTL_X &&
                 projected_x - screen_space_half_width <= (signed int)pViewport->uViewportBR_X) {
                 if (projected_y >= pViewport->uViewportTL_Y && (projected_y - screen_space_height) <= pViewport->uViewportBR_Y) {
-                    assert(uNumBillboardsToDraw < 500);
-                    ++uNumBillboardsToDraw;
+                    AddBillboard();
                     ++uNumDecorationsDrawnThisFrame;
 
                     pBillboardRenderList[uNumBillboardsToDraw - 1].hwsprite =
@@ -1198,7 +1283,62 @@ void IndoorLocation::PrepareDecorationsRenderList_BLV(unsigned int uDecorationID
 }
 
 //----- (00407A1C) --------------------------------------------------------
-bool Check_LineOfSight(const Vec3i &target, const Vec3i &from) {  // target from - true on clear
+namespace {
+struct LineOfSightKey {
+    Vec3i target;
+    Vec3i from;
+
+    friend bool operator==(const LineOfSightKey &l, const LineOfSightKey &r) = default;
+};
+
+struct LineOfSightKeyHash {
+    size_t operator()(const LineOfSightKey &key) const {
+        size_t result = 0;
+        for (int value : {key.target.x, key.target.y, key.target.z, key.from.x, key.from.y, key.from.z})
+            result = result * 1000003 + static_cast<uint32_t>(value);
+        return result;
+    }
+};
+} // namespace
+
+// Mostly needed for stationary actors & party that re-check the same lines every frame. The size limit is there
+// because moving actors produce new keys all the time.
+static constexpr size_t LINE_OF_SIGHT_CACHE_MAX_SIZE = 16384;
+static std::unordered_map<LineOfSightKey, bool, LineOfSightKeyHash> lineOfSightCache;
+static LineOfSightCacheStats lineOfSightCacheStats;
+
+static bool checkLineOfSightUncached(const Vec3i &target, const Vec3i &from);
+
+bool Check_LineOfSight(const Vec3i &target, const Vec3i &from) {
+    LineOfSightKey key = {target, from};
+    auto pos = lineOfSightCache.find(key);
+    if (pos != lineOfSightCache.end()) {
+        lineOfSightCacheStats.hits++;
+        return pos->second;
+    }
+
+    lineOfSightCacheStats.misses++;
+    if (lineOfSightCache.size() >= LINE_OF_SIGHT_CACHE_MAX_SIZE)
+        lineOfSightCache.clear();
+
+    bool result = checkLineOfSightUncached(target, from);
+    lineOfSightCache.emplace(key, result);
+    return result;
+}
+
+void InvalidateLineOfSightCache() {
+    if (lineOfSightCache.empty())
+        return;
+
+    lineOfSightCache.clear();
+    lineOfSightCacheStats.invalidations++;
+}
+
+const LineOfSightCacheStats &GetLineOfSightCacheStats() {
+    return lineOfSightCacheStats;
+}
+
+static bool checkLineOfSightUncached(const Vec3i &target, const Vec3i &from) {  // target from - true on clear
     int AngleToTarget = TrigLUT.atan2(from.x - target.x, from.y - target.y);
     bool LOS_Obscurred = 0;
     bool LOS_Obscurred2 = 0;
@@ -1455,6 +1595,7 @@ char DoInteractionWithTopmostZObject(int pid) {
 }
 //----- (0046BDF1) --------------------------------------------------------
 void BLV_UpdateUserInputAndOther() {
+    RefreshSpatialGrids();
     UpdateObjects();
     BLV_ProcessPartyActions();
     UpdateActors_BLV();
@@ -1464,6 +1605,8 @@ void BLV_UpdateUserInputAndOther() {
 
 //----- (00472866) --------------------------------------------------------
 void BLV_ProcessPartyActions() {  // could this be combined with odm process actions?
+    MM_PROFILE_ZONE("BLV_ProcessPartyActions");
+
     unsigned int uFaceEvent = 0;
 
     bool party_running_flag = false;
@@ -1716,10 +1859,13 @@ void BLV_ProcessPartyActions() {  // could this be combined with odm process act
         if (collision_state.PrepareAndCheckIfStationary(dt))
             break;
 
+        static std::vector<int> nearActors;
+        FindActorsNear(collision_state.bbox, 0, &nearActors);
+
         for (uint j = 0; j < 100; ++j) {
             CollideIndoorWithGeometry(true);
             CollideIndoorWithDecorations();
-            for (int k = 0; k < pActors.size(); ++k)
+            for (int k : nearActors)
                 CollideWithActor(k, 0);
             if (CollideIndoorWithPortals())
                 break; // No portal collisions => can break.
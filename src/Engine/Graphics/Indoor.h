@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -236,6 +238,35 @@ struct BLVSector {  // 0x74
     BBoxs pBounding;
 };
 
+/**
+ * Uniform 2D grid over the bounding boxes of indoor sectors, used to speed up `IndoorLocation::GetSector`.
+ */
+class BLVSectorGrid {
+ public:
+    /**
+     * @param sectors                   Level sectors. Sector zero is a dummy one, and is not added to the grid.
+     * @param margin                    Margin to extend sector bounding boxes by in the XY plane.
+     */
+    void build(const std::vector<BLVSector> &sectors, int margin);
+
+    void clear();
+
+    /**
+     * @return                          Ids of all the sectors that have their extended bounding boxes overlapping
+     *                                  the grid cell containing `(x, y)`, in ascending order.
+     */
+    std::span<const int> sectorsAt(int x, int y) const;
+
+ private:
+    int _x = 0; // Grid origin.
+    int _y = 0;
+    int _width = 0; // Grid size in cells.
+    int _height = 0;
+    int _cellSize = 1;
+    std::vector<int> _cellOffsets; // Cell i contains _sectorIds[_cellOffsets[i].._cellOffsets[i + 1]).
+    std::vector<int> _sectorIds;
+};
+
 /*   89 */
 struct IndoorLocation {
     //----- (00462592) --------------------------------------------------------
@@ -292,6 +323,7 @@ struct IndoorLocation {
     std::vector<int16_t> ptr_0002B4_doors_ddata;
     std::vector<uint16_t> ptr_0002B8_sector_lrdata;
     std::vector<SpawnPoint> pSpawnPoints;
+    BLVSectorGrid sectorGrid;
     LocationInfo dlv;
     LocationTime stru1;
     std::array<char, 875> _visible_outlines;
@@ -392,6 +424,9 @@ int GetIndoorFloorZ(const Vec3i &pos, unsigned int *pSectorID, unsigned int *pFa
 int GetApproximateIndoorFloorZ(const Vec3i &pos, unsigned int *pSectorID, unsigned int *pFaceID);
 
 /**
+ * Results are cached, so repeated checks between the same points are cheap. The cache must be invalidated whenever
+ * level geometry changes, see `InvalidateLineOfSightCache`.
+ *
  * @param target                         Vec3i of position to check line of sight to
  * @param from                           Vec3i of position to check line of sight from
  *
@@ -399,6 +434,23 @@ int GetApproximateIndoorFloorZ(const Vec3i &pos, unsigned int *pSectorID, unsign
  */
 bool Check_LineOfSight(const Vec3i &target, const Vec3i &from);
 
+struct LineOfSightCacheStats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t invalidations = 0;
+};
+
+/**
+ * Drops all cached line of sight results. Should be called when a level is loaded, and when level geometry changes
+ * (e.g. doors move).
+ */
+void InvalidateLineOfSightCache();
+
+/**
+ * @return                              Line of sight cache counters, accumulated since startup.
+ */
+const LineOfSightCacheStats &GetLineOfSightCacheStats();
+
 
 /**
  * @param target                         Vec3i of position to check line of sight to
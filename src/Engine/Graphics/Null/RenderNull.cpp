@@ -0,0 +1,292 @@
+#include "Engine/Graphics/Null/RenderNull.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+#include "Engine/Engine.h"
+#include "Engine/EngineGlobals.h"
+#include "Engine/AssetsManager.h"
+#include "Engine/Graphics/ImageLoader.h"
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/LightmapBuilder.h"
+#include "Engine/Graphics/Null/TextureNull.h"
+#include "Engine/Graphics/Outdoor.h"
+
+#include "Library/Application/PlatformApplication.h"
+
+RenderNull::RenderNull(
+    std::shared_ptr<GameConfig> config,
+    DecalBuilder *decal_builder,
+    SpellFxRenderer *spellfx,
+    std::shared_ptr<ParticleEngine> particle_engine,
+    Vis *vis,
+    Logger *logger
+) : RenderBase(config, decal_builder, lightmap_builder, spellfx, particle_engine, vis, logger) {}
+
+RenderNull::~RenderNull() {}
+
+bool RenderNull::Initialize() {
+    if (!RenderBase::Initialize())
+        return false;
+
+    if (window == nullptr)
+        return false;
+
+    // Context is still created as that's where the frame hooks live, but no GL functions are ever loaded.
+    application->initializeOpenGLContext(PlatformOpenGLOptions());
+    return Reinitialize(true);
+}
+
+bool RenderNull::Reinitialize(bool firstInit) {
+    _outputPresent = window->size();
+    if (config->graphics.RenderFilter.value() != 0)
+        _outputRender = {config->graphics.RenderWidth.value(), config->graphics.RenderHeight.value()};
+    else
+        _outputRender = _outputPresent;
+
+    if (!firstInit)
+        UpdateGameViewport();
+
+    CreateZBuffer();
+
+    openGLContext->swapBuffers();
+    return true;
+}
+
+void RenderNull::ReloadShaders() {}
+
+void RenderNull::Release() {}
+
+Sizei RenderNull::GetRenderDimensions() {
+    return _outputRender;
+}
+
+Sizei RenderNull::GetPresentDimensions() {
+    return _outputPresent;
+}
+
+bool RenderNull::InitializeFullscreen() {
+    return true;
+}
+
+bool RenderNull::SwitchToWindow() {
+    return true;
+}
+
+bool RenderNull::AreRenderSurfacesOk() {
+    return true;
+}
+
+bool RenderNull::NuklearInitialize(struct nk_tex_font *tfont) {
+    return false;
+}
+
+bool RenderNull::NuklearCreateDevice() {
+    return false;
+}
+
+bool RenderNull::NuklearRender(enum nk_anti_aliasing AA, int max_vertex_buffer, int max_element_buffer) {
+    return false;
+}
+
+void RenderNull::NuklearRelease() {}
+
+struct nk_tex_font *RenderNull::NuklearFontLoad(const char *font_path, size_t font_size) {
+    return nullptr;
+}
+
+void RenderNull::NuklearFontFree(struct nk_tex_font *tfont) {}
+
+struct nk_image RenderNull::NuklearImageLoad(Image *img) {
+    struct nk_image result = {};
+    return result;
+}
+
+void RenderNull::NuklearImageFree(Image *img) {}
+
+Texture *RenderNull::CreateTexture_Paletted(const std::string &name) {
+    return TextureNull::Create(new Paletted_Img_Loader(pIcons_LOD, name, 0));
+}
+
+Texture *RenderNull::CreateTexture_ColorKey(const std::string &name, uint16_t colorkey) {
+    return TextureNull::Create(new ColorKey_LOD_Loader(pIcons_LOD, name, colorkey));
+}
+
+Texture *RenderNull::CreateTexture_Solid(const std::string &name) {
+    return TextureNull::Create(new Image16bit_LOD_Loader(pIcons_LOD, name));
+}
+
+Texture *RenderNull::CreateTexture_Alpha(const std::string &name) {
+    return TextureNull::Create(new Alpha_LOD_Loader(pIcons_LOD, name));
+}
+
+Texture *RenderNull::CreateTexture_PCXFromIconsLOD(const std::string &name) {
+    return TextureNull::Create(new PCX_LOD_Compressed_Loader(pIcons_LOD, name));
+}
+
+Texture *RenderNull::CreateTexture_PCXFromNewLOD(const std::string &name) {
+    return TextureNull::Create(new PCX_LOD_Compressed_Loader(pSave_LOD, name));
+}
+
+Texture *RenderNull::CreateTexture_PCXFromFile(const std::string &name) {
+    return TextureNull::Create(new PCX_File_Loader(name));
+}
+
+Texture *RenderNull::CreateTexture_PCXFromLOD(LOD::File *pLOD, const std::string &name) {
+    return TextureNull::Create(new PCX_LOD_Raw_Loader(pLOD, name));
+}
+
+Texture *RenderNull::CreateTexture_Blank(unsigned int width, unsigned int height,
+    IMAGE_FORMAT format, const void *pixels) {
+    return TextureNull::Create(width, height, format, pixels);
+}
+
+Texture *RenderNull::CreateTexture(const std::string &name) {
+    return TextureNull::Create(new Bitmaps_LOD_Loader(pBitmaps_LOD, name, engine->config->graphics.HWLBitmaps.value()));
+}
+
+Texture *RenderNull::CreateSprite(const std::string &name, unsigned int palette_id,
+                                  /*refactor*/ unsigned int lod_sprite_id) {
+    return TextureNull::Create(
+        new Sprites_LOD_Loader(pSprites_LOD, palette_id, name, lod_sprite_id, engine->config->graphics.HWLSprites.value()));
+}
+
+void RenderNull::RemoveTextureFromDevice(Texture *texture) {}
+
+bool RenderNull::MoveTextureToDevice(Texture *texture) {
+    return true;
+}
+
+void RenderNull::Update_Texture(Texture *texture) {}
+
+void RenderNull::DeleteTexture(Texture *texture) {}
+
+uint8_t *RenderNull::ReadScreenPixels() {
+    size_t size = 4 * _outputRender.w * _outputRender.h;
+    uint8_t *pixels = new uint8_t[size];
+    memset(pixels, 0, size);
+    return pixels;
+}
+
+void RenderNull::SaveWinnersCertificate(const std::string &filePath) {
+    uint8_t *pixels = ReadScreenPixels();
+    assets->winnerCert = CreateTexture_Blank(_outputRender.w, _outputRender.h, IMAGE_FORMAT::IMAGE_FORMAT_A8B8G8R8, pixels);
+    SavePCXImage32(filePath, (uint32_t *)pixels, _outputRender.w, _outputRender.h);
+    delete[] pixels;
+}
+
+uint32_t *RenderNull::MakeScreenshot32(const int width, const int height) {
+    // Drawing still has to happen, as it updates the billboard list & face visibility flags.
+    BeginScene3D();
+
+    if (uCurrentlyLoadedLevelType == LEVEL_Indoor) {
+        pIndoor->Draw();
+    } else if (uCurrentlyLoadedLevelType == LEVEL_Outdoor) {
+        pOutdoor->Draw();
+    }
+
+    DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene();
+
+    uint32_t *pixels = (uint32_t *)calloc(width * height, sizeof(uint32_t));
+    assert(pixels);
+    return pixels;
+}
+
+void RenderNull::Present() {
+    openGLContext->swapBuffers();
+}
+
+void RenderNull::BeginScene3D() {
+    uNumBillboardsToDraw = 0;
+}
+
+void RenderNull::BeginScene2D() {}
+
+void RenderNull::ClearTarget(unsigned int uColor) {}
+
+void RenderNull::RestoreFrontBuffer() {}
+
+void RenderNull::RestoreBackBuffer() {}
+
+void RenderNull::BltBackToFontFast(int a2, int a3, Recti *pSrcRect) {}
+
+void RenderNull::BeginLines2D() {}
+
+void RenderNull::EndLines2D() {}
+
+void RenderNull::RasterLine2D(signed int uX, signed int uY, signed int uZ, signed int uW, uint32_t uColor32) {}
+
+void RenderNull::DrawLines(const RenderVertexD3D3 *vertices, unsigned int num_vertices) {}
+
+void RenderNull::DrawTerrainPolygon(struct Polygon *a4, bool transparent, bool clampAtTextureBorders) {}
+
+void RenderNull::DrawProjectile(float srcX, float srcY, float a3, float a4,
+                                float dstX, float dstY, float a7, float a8,
+                                Texture *texture) {}
+
+void RenderNull::ScreenFade(unsigned int color, float t) {}
+
+void RenderNull::SetUIClipRect(unsigned int uX, unsigned int uY, unsigned int uZ, unsigned int uW) {}
+
+void RenderNull::ResetUIClipRect() {}
+
+void RenderNull::DrawTextureNew(float u, float v, Image *img, uint32_t colourmask) {}
+
+void RenderNull::DrawTextureCustomHeight(float u, float v, Image *img, int height) {}
+
+void RenderNull::DrawTextureOffset(int x, int y, int offset_x, int offset_y, Image *img) {}
+
+void RenderNull::DrawImage(Image *img, const Recti &rect, uint paletteid, uint32_t colourmask32) {}
+
+void RenderNull::BlendTextures(int a2, int a3, Image *a4, Image *a5, int t, int start_opacity, int end_opacity) {}
+
+void RenderNull::TexturePixelRotateDraw(float u, float v, Image *img, int time) {}
+
+void RenderNull::BeginTextNew(Texture *main, Texture *shadow) {}
+
+void RenderNull::EndTextNew() {}
+
+void RenderNull::DrawTextNew(int x, int y, int w, int h, float u1, float v1, float u2, float v2, int isshadow, uint16_t colour) {}
+
+void RenderNull::FillRectFast(unsigned int uX, unsigned int uY, unsigned int uWidth, unsigned int uHeight, uint32_t uColor32) {}
+
+void RenderNull::DrawOutdoorBuildings() {}
+
+void RenderNull::DrawIndoorSky(unsigned int uNumVertices, unsigned int uFaceID) {}
+
+void RenderNull::DrawOutdoorSky() {}
+
+void RenderNull::DrawOutdoorTerrain() {}
+
+void RenderNull::BeginLightmaps() {}
+
+void RenderNull::EndLightmaps() {}
+
+void RenderNull::BeginLightmaps2() {}
+
+void RenderNull::EndLightmaps2() {}
+
+bool RenderNull::DrawLightmap(struct Lightmap *pLightmap, Vec3f *pColorMult, float z_bias) {
+    return true;
+}
+
+void RenderNull::BeginDecals() {}
+
+void RenderNull::EndDecals() {}
+
+void RenderNull::DrawDecal(struct Decal *pDecal, float z_bias) {}
+
+void RenderNull::DrawFromSpriteSheet(Recti *pSrcRect, Pointi *pTargetPoint, int a3, int blend_mode) {}
+
+void RenderNull::DrawIndoorFaces() {
+    MarkIndoorFacesSeenByParty();
+}
+
+void RenderNull::ReleaseTerrain() {}
+
+void RenderNull::ReleaseBSP() {}
+
+void RenderNull::DrawTwodVerts() {}
+
+void RenderNull::DoRenderBillboards_D3D() {}
@@ -0,0 +1,25 @@
+#include "Engine/Graphics/Null/TextureNull.h"
+
+#include <cstring>
+
+Texture *TextureNull::Create(unsigned int width, unsigned int height, IMAGE_FORMAT format, const void *pixels) {
+    auto tex = new TextureNull(false);
+    tex->initialized = true;
+    tex->width = width;
+    tex->height = height;
+    tex->native_format = format;
+    unsigned int num_pixels_bytes = width * height * IMAGE_FORMAT_BytesPerPixel(format);
+    tex->pixels[format] = new unsigned char[num_pixels_bytes];
+    if (pixels) {
+        memcpy(tex->pixels[format], pixels, num_pixels_bytes);
+    } else {
+        memset(tex->pixels[format], 0, num_pixels_bytes);
+    }
+    return tex;
+}
+
+Texture *TextureNull::Create(ImageLoader *loader) {
+    auto tex = new TextureNull();
+    tex->loader = loader;
+    return tex;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include "Engine/Graphics/Texture.h"
+
+/**
+ * Texture for the null renderer. Pixel data is still decoded on demand as some of the game logic looks into it
+ * (e.g. `ZDrawTextureAlpha`), but nothing is ever uploaded anywhere.
+ */
+class TextureNull : public Texture {
+ protected:
+    friend class RenderNull;
+
+    static Texture *Create(unsigned int width, unsigned int height, IMAGE_FORMAT format, const void *pixels);
+
+    static Texture *Create(ImageLoader *loader);
+
+    explicit TextureNull(bool lazy_initialization = true)
+        : Texture(lazy_initialization) {}
+};
@@ -43,7 +43,6 @@
 
 #include "Utility/Geometry/Size.h"
 #include "Utility/Format.h"
-#include "Utility/Memory/MemSet.h"
 #include "Utility/Math/TrigLut.h"
 
 #ifndef LOWORD
@@ -56,8 +55,6 @@ static constexpr int DEFAULT_AMBIENT_LIGHT_LEVEL = 0;
 //TODO(pskelton): Combine and contain
 std::shared_ptr<IRender> render;
 int uNumDecorationsDrawnThisFrame;
-RenderBillboard pBillboardRenderList[500];
-unsigned int uNumBillboardsToDraw;
 int uNumSpritesDrawnThisFrame;
 RenderVertexSoft array_73D150[20];
 RenderVertexSoft VertexRenderList[50];
@@ -255,23 +252,6 @@ void RenderOpenGL::ClearTarget(unsigned int uColor) {
 }
 
 
-// TODO(pskelton): z buffer must go
-void RenderOpenGL::CreateZBuffer() {
-    if (pActiveZBuffer)
-        free(pActiveZBuffer);
-
-    pActiveZBuffer = (int*)malloc(outputRender.w * outputRender.h * sizeof(int));
-    if (!pActiveZBuffer)
-        Error("Failed to create zbuffer");
-
-    ClearZBuffer();
-}
-
-// TODO(pskelton): z buffer must go
-void RenderOpenGL::ClearZBuffer() {
-    memset32(this->pActiveZBuffer, 0xFFFF0000, outputRender.w * outputRender.h);
-}
-
 struct linesverts {
     GLfloat x;
     GLfloat y;
@@ -311,6 +291,11 @@ void RenderOpenGL::BeginLines2D() {
 void RenderOpenGL::EndLines2D() {
     if (!linevertscnt) return;
 
+    if (presentationSkipped) {
+        linevertscnt = 0;
+        return;
+    }
+
     // update buffer
     glBindBuffer(GL_ARRAY_BUFFER, lineVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(lineshaderstore), NULL, GL_DYNAMIC_DRAW);
@@ -836,30 +821,6 @@ void RenderOpenGL::DrawImage(Image *img, const Recti &rect, uint paletteid, uint
 }
 
 // TODO(pskelton): zbuffer must go
-void RenderOpenGL::ZDrawTextureAlpha(float u, float v, Image *img, int zVal) {
-    if (!img) return;
-
-    int uOutX = static_cast<int>(u * outputRender.w);
-    int uOutY = static_cast<int>(v * outputRender.h);
-    int imgheight = img->GetHeight();
-    int imgwidth = img->GetWidth();
-    auto pixels = (uint32_t *)img->GetPixels(IMAGE_FORMAT_A8B8G8R8);
-
-    if (uOutX < 0)
-        uOutX = 0;
-    if (uOutY < 0)
-        uOutY = 0;
-
-    for (int xs = 0; xs < imgwidth; xs++) {
-        for (int ys = 0; ys < imgheight; ys++) {
-            if (pixels[xs + imgwidth * ys] & 0xFF000000) {
-                this->pActiveZBuffer[uOutX + xs + outputRender.w * (uOutY + ys)] = zVal;
-            }
-        }
-    }
-}
-
-
 // TODO(pskelton): sort this - forcing the draw is slow
 // TODO(pskelton): stencil masking with opacity would be a better way to do this
 void RenderOpenGL::BlendTextures(int x, int y, Image *imgin, Image *imgblend, int time, int start_opacity,
@@ -1183,36 +1144,6 @@ uint32_t *RenderOpenGL::MakeScreenshot32(const int width, const int height) {
     return pPixels;
 }
 
-// TODO: should this be combined / moved out of render
-std::vector<Actor*> RenderOpenGL::getActorsInViewport(int pDepth) {
-    std::vector<Actor*> foundActors;
-
-    for (int i = 0; i < render->uNumBillboardsToDraw; i++) {
-        int renderId = render->pBillboardRenderListD3D[i].sParentBillboardID;
-        if(renderId == -1) {
-            continue; // E.g. spell particle.
-        }
-
-        int pid = pBillboardRenderList[renderId].object_pid;
-        if (PID_TYPE(pid) == OBJECT_Actor) {
-            if (pBillboardRenderList[renderId].screen_space_z <= pDepth) {
-                int id = PID_ID(pid);
-                if (pActors[id].uAIState != Dead &&
-                    pActors[id].uAIState != Dying &&
-                    pActors[id].uAIState != Removed &&
-                    pActors[id].uAIState != Disabled &&
-                    pActors[id].uAIState != Summoned) {
-                    if (vis->DoesRayIntersectBillboard(static_cast<float>(pDepth), i)) {
-                        // Limit for 100 actors was removed
-                        foundActors.push_back(&pActors[id]);
-                    }
-                }
-            }
-        }
-    }
-    return foundActors;
-}
-
 // TODO(pskelton): drop - not required in gl renderer now
 void RenderOpenGL::BeginLightmaps() { return; }
 void RenderOpenGL::EndLightmaps() { return; }
@@ -1283,6 +1214,11 @@ void RenderOpenGL::BeginDecals() {
 }
 
 void RenderOpenGL::EndDecals() {
+    if (presentationSkipped) {
+        numdecalverts = 0;
+        return;
+    }
+
     // draw here
 
     if (numdecalverts) {
@@ -1720,6 +1656,9 @@ struct GLshaderverts {
 GLshaderverts terrshaderstore[127 * 127 * 6] = {};
 
 void RenderOpenGL::DrawOutdoorTerrain() {
+    if (presentationSkipped)
+        return;
+
     // shader version
     // draws entire terrain in one go at the moment
     // textures must all be square and same size
@@ -2282,6 +2221,9 @@ void RenderOpenGL::DrawTerrainPolygon(struct Polygon *poly, bool transparent, bo
 
 // TODO(pskelton): renderbase
 void RenderOpenGL::DrawOutdoorSky() {
+    if (presentationSkipped)
+        return;
+
     double rot_to_rads = ((2 * pi_double) / 2048);
 
     // lowers clouds as party goes up
@@ -2566,6 +2508,11 @@ void RenderOpenGL::DrawOutdoorSkyPolygon(struct Polygon *pSkyPolygon) {
 void RenderOpenGL::DrawForcePerVerts() {
     if (!forceperstorecnt) return;
 
+    if (presentationSkipped) {
+        forceperstorecnt = 0;
+        return;
+    }
+
     if (forceperVAO == 0) {
         glGenVertexArrays(1, &forceperVAO);
         glGenBuffers(1, &forceperVBO);
@@ -2728,6 +2675,9 @@ int billbstorecnt{ 0 };
 
 //----- (004A1C1E) --------------------------------------------------------
 void RenderOpenGL::DoRenderBillboards_D3D() {
+    if (presentationSkipped)
+        return;
+
     glEnable(GL_BLEND);
     glDepthMask(GL_FALSE);  // in theory billboards all sorted by depth so dont cull by depth test
     glDisable(GL_CULL_FACE);  // some quads are reversed to reuse sprites opposite hand
@@ -2777,7 +2727,6 @@ void RenderOpenGL::DoRenderBillboards_D3D() {
         //}
 
         auto billboard = &pBillboardRenderListD3D[i];
-        auto b = &pBillboardRenderList[i];
 
         float oneoz = 1.0f / billboard->screen_space_z;
         float thisdepth = (oneoz - oneon) / (oneof - oneon);
@@ -3362,6 +3311,11 @@ void RenderOpenGL::BeginTextNew(Texture *main, Texture *shadow) {
 void RenderOpenGL::EndTextNew() {
     if (!textvertscnt) return;
 
+    if (presentationSkipped) {
+        textvertscnt = 0;
+        return;
+    }
+
     if (twodvertscnt) {
         DrawTwodVerts();
     }
@@ -3568,7 +3522,7 @@ void RenderOpenGL::Present() {
     EndLines2D();
     EndTextNew();
 
-    if (outputRender != outputPresent) {
+    if (outputRender != outputPresent && !presentationSkipped) {
         glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
         glDisable(GL_SCISSOR_TEST);
 
@@ -3614,6 +3568,9 @@ GLshaderverts *outbuildshaderstore[16] = { nullptr };
 int numoutbuildverts[16] = { 0 };
 
 void RenderOpenGL::DrawOutdoorBuildings() {
+    if (presentationSkipped)
+        return;
+
     // shader
     // verts are streamed to gpu as required
     // textures can be different sizes
@@ -4243,6 +4200,11 @@ GLshaderverts *BSPshaderstore[16] = { nullptr };
 int numBSPverts[16] = { 0 };
 
 void RenderOpenGL::DrawIndoorFaces() {
+    if (presentationSkipped) {
+        MarkIndoorFacesSeenByParty();
+        return;
+    }
+
     // void RenderOpenGL::DrawIndoorBSP() {
 
     // TODO(pskelton): might have to pass a texture width through for the waterr flow textures to size right
@@ -5256,24 +5218,8 @@ bool RenderOpenGL::Reinitialize(bool firstInit) {
     else
         outputRender = outputPresent;
 
-    if (!firstInit) {
-        game_viewport_x = viewparams->uScreen_topL_X = engine->config->graphics.ViewPortX1.value(); //8
-        game_viewport_y = viewparams->uScreen_topL_Y = engine->config->graphics.ViewPortY1.value(); //8
-        game_viewport_z = viewparams->uScreen_BttmR_X = outputRender.w - engine->config->graphics.ViewPortX2.value(); //468;
-        game_viewport_w = viewparams->uScreen_BttmR_Y = outputRender.h - engine->config->graphics.ViewPortY2.value(); //352;
-
-        game_viewport_width = game_viewport_z - game_viewport_x;
-        game_viewport_height = game_viewport_w - game_viewport_y;
-
-        viewparams->uSomeY = viewparams->uScreen_topL_Y;
-        viewparams->uSomeX = viewparams->uScreen_topL_X;
-        viewparams->uSomeZ = viewparams->uScreen_BttmR_X;
-        viewparams->uSomeW = viewparams->uScreen_BttmR_Y;
-
-        pViewport->SetScreen(viewparams->uScreen_topL_X, viewparams->uScreen_topL_Y,
-                            viewparams->uScreen_BttmR_X,
-                            viewparams->uScreen_BttmR_Y);
-    }
+    if (!firstInit)
+        UpdateGameViewport();
 
     // pViewport->ResetScreen();
     CreateZBuffer();
@@ -5523,6 +5469,11 @@ void RenderOpenGL::ReleaseBSP() {
 void RenderOpenGL::DrawTwodVerts() {
     if (!twodvertscnt) return;
 
+    if (presentationSkipped) {
+        twodvertscnt = 0;
+        return;
+    }
+
     int savex = this->clip_x;
     int savey = this->clip_y;
     int savez = this->clip_z;
@@ -62,7 +62,6 @@ class RenderOpenGL : public RenderBase {
 
     virtual bool InitializeFullscreen() override;
 
-    virtual void CreateZBuffer() override;
     virtual void Release() override;
 
     virtual bool SwitchToWindow() override;
@@ -74,7 +73,6 @@ class RenderOpenGL : public RenderBase {
     virtual void DrawLines(const RenderVertexD3D3 *vertices,
         unsigned int num_vertices) override;
 
-    virtual void ClearZBuffer() override;
     virtual void RestoreFrontBuffer() override;
     virtual void RestoreBackBuffer() override;
     virtual void BltBackToFontFast(int a2, int a3, Recti *pSrcRect) override;
@@ -109,7 +107,6 @@ class RenderOpenGL : public RenderBase {
                                    Image *) override;
     virtual void DrawImage(Image *, const Recti &rect, uint paletteid = 0, uint32_t colourmask32 = 0xFFFFFFFF) override;
 
-    virtual void ZDrawTextureAlpha(float u, float v, Image *pTexture, int zVal) override;
     virtual void BlendTextures(int a2, int a3, Image *a4, Image *a5, int t,
                                int start_opacity, int end_opacity) override;
     virtual void TexturePixelRotateDraw(float u, float v, Image *img, int time) override;
@@ -132,7 +129,6 @@ class RenderOpenGL : public RenderBase {
 
     virtual uint32_t *MakeScreenshot32(const int width, const int height) override;
 
-    virtual std::vector<Actor*> getActorsInViewport(int pDepth) override;
 
     virtual void BeginLightmaps() override;
     virtual void EndLightmaps() override;
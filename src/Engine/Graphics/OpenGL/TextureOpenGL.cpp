@@ -1,4 +1,5 @@
 #include "Engine/Graphics/OpenGL/TextureOpenGL.h"
+#include "Engine/AssetsManager.h"
 #include "Engine/Graphics/IRender.h"
 #include "Engine/Graphics/ImageLoader.h"
 #include "Engine/ErrorHandling.h"
@@ -46,6 +47,11 @@ Texture *TextureOpenGL::Create(ImageLoader *loader) {
 int TextureOpenGL::GetOpenGlTexture(bool bLoad) {
     if (bLoad) {
         if (!this->initialized) {
+            // Draw a placeholder while the texture is being decoded in the background,
+            // it will be uploaded in AssetsManager::uploadCompletedTextures.
+            if (this->IsAsyncLoadPending() || assets->startAsyncLoad(this))
+                return static_cast<TextureOpenGL *>(assets->placeholderTexture())->GetOpenGlTexture();
+
             this->LoadImageData();
         }
 
@@ -60,16 +66,15 @@ int TextureOpenGL::GetOpenGlTexture(bool bLoad) {
 
 bool TextureOpenGL::LoadImageData() {
     if (!this->initialized) {
-        void *pixels {nullptr};
-        void *palette {nullptr};
-        void *palettepixels {nullptr};
-
-        this->initialized =
-            this->loader->Load(&width, &height, &pixels, &native_format, &palette, &palettepixels);
+        LoadResult result = this->RunLoader();
+        this->width = result.width;
+        this->height = result.height;
+        this->native_format = result.format;
+        this->initialized = result.loaded;
         if (this->initialized && this->native_format != IMAGE_INVALID_FORMAT) {
-            this->pixels[native_format] = pixels;
-            this->palette24 = palette;
-            this->palettepixels = palettepixels;
+            this->pixels[native_format] = result.pixels;
+            this->palette24 = result.palette;
+            this->palettepixels = result.palettepixels;
             this->initialized = render->MoveTextureToDevice(this);
             if (!this->initialized) {
                 __debugbreak();
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -15,6 +16,7 @@
 #include "Engine/Graphics/LightsStack.h"
 #include "Engine/Graphics/PaletteManager.h"
 #include "Engine/Graphics/ParticleEngine.h"
+#include "Engine/Graphics/SpatialGrid.h"
 #include "Engine/Graphics/Sprites.h"
 #include "Engine/Graphics/Viewport.h"
 #include "Engine/Graphics/Weather.h"
@@ -25,6 +27,7 @@
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/OurMath.h"
 #include "Engine/Party.h"
+#include "Engine/SaveLoad.h"
 #include "Engine/Serialization/CompositeImages.h"
 #include "Engine/SpellFxRenderer.h"
 #include "Engine/Tables/ItemTable.h"
@@ -39,6 +42,7 @@
 #include "GUI/UI/UIRest.h"
 #include "GUI/UI/UITransition.h"
 
+#include "Library/Profiler/Profiler.h"
 #include "Library/Random/Random.h"
 
 #include "Utility/Memory/FreeDeleter.h"
@@ -54,6 +58,18 @@ OutdoorLocation *pOutdoor = new OutdoorLocation;
 ODMRenderParams *pODMRenderParams;
 
 SkyBillboardStruct SkyBillboard;  // skybox planes
+
+struct OutdoorFloorFace {
+    unsigned int modelId;
+    unsigned int faceId;
+};
+
+static constexpr int FLOOR_GRID_SIZE = 128;
+
+// Floor faces by terrain grid cell, cell i owns the range [floorFaceCellOffsets[i], floorFaceCellOffsets[i + 1]) in
+// floorFaces. Within a cell the faces are in model order, same as in pOutdoor->pBModels.
+static std::array<uint32_t, FLOOR_GRID_SIZE * FLOOR_GRID_SIZE + 1> floorFaceCellOffsets = {};
+static std::vector<OutdoorFloorFace> floorFaces;
 std::array<struct Polygon, 2000 + 18000> array_77EC08;
 
 struct FogProbabilityTableEntry {
@@ -822,6 +838,8 @@ void OutdoorLocation::Release() {
     this->sky_texture_filename = "sky043";
 
     pBModels.clear();
+    PrepareOutdoorCollisions();
+    PrepareOutdoorFloorFaces();
     pSpawnPoints.clear();
     pTerrain.Release();
     pFaceIDLIST.clear();
@@ -858,18 +876,25 @@ void OutdoorLocation::Load(const std::string &filename, int days_played, int res
     std::string odm_filename = std::string(filename);
     odm_filename.replace(odm_filename.length() - 4, 4, ".odm");
 
+    std::string ddm_filename = filename;
+    ddm_filename = ddm_filename.replace(ddm_filename.length() - 4, 4, ".ddm");
+
+    // The initial delta is only needed on respawn, but decompressing it alongside the level is nearly free.
+    std::vector<Blob> levelFiles = LoadGamesLodFiles({odm_filename, ddm_filename});
+
     OutdoorLocation_MM7 location;
-    deserialize(pGames_LOD->LoadCompressed(odm_filename), &location);
+    deserialize(levelFiles[0], &location);
     deserialize(location, this);
+    PrepareOutdoorCollisions();
+    PrepareOutdoorFloorFaces();
+    InvalidateLineOfSightCache();
 
     // ****************.ddm file*********************//
 
-    std::string ddm_filename = filename;
-    ddm_filename = ddm_filename.replace(ddm_filename.length() - 4, 4, ".ddm");
-
     bool respawnInitial = false; // Perform initial location respawn?
     bool respawnTimed = false; // Perform timed location respawn?
     OutdoorDelta_MM7 delta;
+    WaitForPendingSave();
     if (Blob blob = pSave_LOD->LoadCompressed(ddm_filename)) {
         try {
             deserialize(blob, &delta, location);
@@ -901,13 +926,13 @@ void OutdoorLocation::Load(const std::string &filename, int days_played, int res
     assert(respawnInitial + respawnTimed <= 1);
 
     if (respawnInitial) {
-        deserialize(pGames_LOD->LoadCompressed(ddm_filename), &delta, location);
+        deserialize(levelFiles[1], &delta, location);
         *outdoors_was_respawned = true;
     } else if (respawnTimed) {
         auto header = delta.header;
         auto fullyRevealedCells = delta.fullyRevealedCells;
         auto partiallyRevealedCells = delta.partiallyRevealedCells;
-        deserialize(pGames_LOD->LoadCompressed(ddm_filename), &delta, location);
+        deserialize(levelFiles[1], &delta, location);
         delta.header = header;
         delta.fullyRevealedCells = fullyRevealedCells;
         delta.partiallyRevealedCells = partiallyRevealedCells;
@@ -1311,8 +1336,6 @@ void OutdoorLocation::PrepareActorsDrawList() {
             continue;
         }
 
-        if (uNumBillboardsToDraw >= 500) return;
-
         // view culling
         if (uCurrentlyLoadedLevelType == LEVEL_Indoor) {
             bool onlist = false;
@@ -1410,7 +1433,7 @@ void OutdoorLocation::PrepareActorsDrawList() {
                 if (projected_x + screen_space_half_width >= (signed int)pViewport->uViewportTL_X &&
                     projected_x - screen_space_half_width <= (signed int)pViewport->uViewportBR_X) {
                     if (projected_y >= pViewport->uViewportTL_Y && (projected_y - screen_space_height) <= pViewport->uViewportBR_Y) { // test
-                        ++uNumBillboardsToDraw;
+                        AddBillboard();
                         ++uNumSpritesDrawnThisFrame;
 
                         pActors[i].uAttributes |= ACTOR_VISIBLE;
@@ -1458,6 +1481,48 @@ void OutdoorLocation::PrepareActorsDrawList() {
     }
 }
 
+template<class Callback>
+static void forEachFloorFaceCell(const BBoxs &box, Callback callback) {
+    int x1 = WorldPosToGridCellXClamped(box.x1);
+    int x2 = WorldPosToGridCellXClamped(box.x2);
+    int y1 = WorldPosToGridCellYClamped(box.y2); // Grid Y axis is flipped.
+    int y2 = WorldPosToGridCellYClamped(box.y1);
+
+    for (int y = y1; y <= y2; y++)
+        for (int x = x1; x <= x2; x++)
+            callback(x + y * FLOOR_GRID_SIZE);
+}
+
+static bool isFloorFace(const ODMFace &face) {
+    if (face.uNumVertices == 0)
+        return false;
+    return face.uPolygonType == POLYGON_Floor || face.uPolygonType == POLYGON_InBetweenFloorAndWall;
+}
+
+void PrepareOutdoorFloorFaces() {
+    std::array<uint32_t, FLOOR_GRID_SIZE * FLOOR_GRID_SIZE> counts = {};
+    for (const BSPModel &model : pOutdoor->pBModels)
+        for (const ODMFace &face : model.pFaces)
+            if (isFloorFace(face))
+                forEachFloorFaceCell(face.pBoundingBox, [&](int cell) { counts[cell]++; });
+
+    floorFaceCellOffsets[0] = 0;
+    for (size_t i = 0; i < counts.size(); i++)
+        floorFaceCellOffsets[i + 1] = floorFaceCellOffsets[i] + counts[i];
+
+    floorFaces.clear();
+    floorFaces.resize(floorFaceCellOffsets.back());
+
+    // Reuse counts as per-cell write cursors.
+    std::copy(floorFaceCellOffsets.begin(), floorFaceCellOffsets.end() - 1, counts.begin());
+    for (const BSPModel &model : pOutdoor->pBModels)
+        for (const ODMFace &face : model.pFaces)
+            if (isFloorFace(face))
+                forEachFloorFaceCell(face.pBoundingBox, [&](int cell) {
+                    floorFaces[counts[cell]++] = {model.index, face.index};
+                });
+}
+
 int ODM_GetFloorLevel(const Vec3i &pos, int unused, bool *pIsOnWater,
                       int *bmodel_pid, int bWaterWalk) {
     std::array<int, 20> current_Face_id{};                   // dword_721110
@@ -1468,45 +1533,39 @@ int ODM_GetFloorLevel(const Vec3i &pos, int unused, bool *pIsOnWater,
     odm_floor_level[0] = GetTerrainHeightsAroundParty2(pos.x, pos.y, pIsOnWater, bWaterWalk);
 
     int surface_count = 1;
+    int slack = engine->config->gameplay.FloorChecksEps.value();
 
-    for (BSPModel &model : pOutdoor->pBModels) {
+    // Only the faces with bounding boxes overlapping the cell under pos are checked. Ethereal flag is checked here and
+    // not when building the index as it's toggled by scripts.
+    int cell = WorldPosToGridCellXClamped(pos.x) + WorldPosToGridCellYClamped(pos.y) * FLOOR_GRID_SIZE;
+    for (uint32_t i = floorFaceCellOffsets[cell]; i < floorFaceCellOffsets[cell + 1]; i++) {
+        BSPModel &model = pOutdoor->pBModels[floorFaces[i].modelId];
         if (!model.pBoundingBox.containsXY(pos.x, pos.y))
             continue;
 
-        if (model.pFaces.empty())
+        ODMFace &face = model.pFaces[floorFaces[i].faceId];
+        if (face.Ethereal())
             continue;
 
-        for (ODMFace &face : model.pFaces) {
-            if (face.Ethereal())
-                continue;
-
-            if (face.uNumVertices == 0)
-                continue;
-
-            if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
-                continue;
-
-            if (!face.pBoundingBox.containsXY(pos.x, pos.y))
-                continue;
-
-            int slack = engine->config->gameplay.FloorChecksEps.value();
-            if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
-                continue;
+        if (!face.pBoundingBox.containsXY(pos.x, pos.y))
+            continue;
 
-            int floor_level;
-            if (face.uPolygonType == POLYGON_Floor) {
-                floor_level = model.pVertices[face.pVertexIDs[0]].z;
-            } else {
-                floor_level = face.zCalc.calculate(pos.x, pos.y);
-            }
-            odm_floor_level[surface_count] = floor_level;
-            current_BModel_id[surface_count] = model.index;
-            current_Face_id[surface_count] = face.index;
-            surface_count++;
+        if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
+            continue;
 
-            if (surface_count >= 20)
-                break;
+        int floor_level;
+        if (face.uPolygonType == POLYGON_Floor) {
+            floor_level = model.pVertices[face.pVertexIDs[0]].z;
+        } else {
+            floor_level = face.zCalc.calculate(pos.x, pos.y);
         }
+        odm_floor_level[surface_count] = floor_level;
+        current_BModel_id[surface_count] = model.index;
+        current_Face_id[surface_count] = face.index;
+        surface_count++;
+
+        if (surface_count >= 20)
+            break;
     }
 
     if (surface_count == 1) {
@@ -1595,6 +1654,7 @@ void ODM_UpdateUserInputAndOther() {
     bool v0;        // eax@5
     char pOut[32];  // [sp+8h] [bp-20h]@5
 
+    RefreshSpatialGrids();
     UpdateObjects();
     ODM_ProcessPartyActions();
     if (pParty->vPosition.x < -22528 || pParty->vPosition.x > 22528 ||
@@ -1655,6 +1715,8 @@ void OutdoorLocation::subconstuctor() {
 // TODO(pskelton): Pass party as param
 //----- (00473893) --------------------------------------------------------
 void ODM_ProcessPartyActions() {
+    MM_PROFILE_ZONE("ODM_ProcessPartyActions");
+
     bool waterWalkActive = false;
     pParty->uFlags &= ~PARTY_FLAGS_1_STANDING_ON_WATER;
     if (pParty->WaterWalkActive()) {
@@ -2094,7 +2156,9 @@ void ODM_ProcessPartyActions() {
         CollideOutdoorWithDecorations(WorldPosToGridCellX(pParty->vPosition.x), WorldPosToGridCellY(pParty->vPosition.y));
         _46ED8A_collide_against_sprite_objects(4);
 
-        for (uint actor_id = 0; actor_id < (signed int)pActors.size(); ++actor_id)
+        static std::vector<int> nearActors;
+        FindActorsNear(collision_state.bbox, 0, &nearActors);
+        for (int actor_id : nearActors)
             CollideWithActor(actor_id, 0);
 
         int new_pos_low_y{};
@@ -2849,6 +2913,14 @@ unsigned int WorldPosToGridCellY(int sWorldPosY) {
                                     //                               and -880 sar 9 = -2
 }
 
+int WorldPosToGridCellXClamped(int sWorldPosX) {
+    return std::clamp((sWorldPosX >> 9) + 64, 0, 127);
+}
+
+int WorldPosToGridCellYClamped(int sWorldPosY) {
+    return std::clamp(63 - (sWorldPosY >> 9), 0, 127);
+}
+
 //----- (0047F469) --------------------------------------------------------
 int GridCellToWorldPosX(int a1) { return (a1 - 64) << 9; }
 
@@ -198,6 +198,11 @@ struct OutdoorLocation {
 extern OutdoorLocation *pOutdoor;
 
 void ODM_UpdateUserInputAndOther();
+/**
+ * Rebuilds the floor face index used by `ODM_GetFloorLevel` from the models of the currently loaded outdoor location.
+ * Must be called whenever `pOutdoor->pBModels` changes.
+ */
+void PrepareOutdoorFloorFaces();
 int ODM_GetFloorLevel(const Vec3i &pos, int unused, bool *pOnWater,
                       int *bmodel_pid, int bWaterWalk);
 int GetCeilingHeight(int Party_X, signed int Party_Y, int Party_ZHeight,
@@ -214,6 +219,14 @@ unsigned int GetLevelFogColor();
 int sub_47C3D7_get_fog_specular(int unused, int a2, float a3);
 unsigned int WorldPosToGridCellX(int);
 unsigned int WorldPosToGridCellY(int);
+
+/**
+ * Same as `WorldPosToGridCellX` & `WorldPosToGridCellY`, but clamped to the 128x128 terrain grid, so that positions
+ * outside of the map map to the border cells.
+ */
+int WorldPosToGridCellXClamped(int sWorldPosX);
+int WorldPosToGridCellYClamped(int sWorldPosY);
+
 int GridCellToWorldPosX(int);
 int GridCellToWorldPosY(int);
 void sub_481ED9_MessWithODMRenderParams();
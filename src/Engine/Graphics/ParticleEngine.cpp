@@ -1,5 +1,9 @@
 #include "Engine/Graphics/ParticleEngine.h"
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 #include "Engine/Graphics/Camera.h"
 #include "Engine/LOD.h"
 #include "Engine/OurMath.h"
@@ -46,62 +50,79 @@ void TrailParticleGenerator::UpdateParticles() {
 }
 
 ParticleEngine::ParticleEngine() {
+    setCapacity(DEFAULT_CAPACITY);
+}
+
+void ParticleEngine::setCapacity(int capacity) {
+    assert(capacity > 0);
+
+    pParticles.resize(capacity);
     ResetParticles();
 }
 
 void ParticleEngine::ResetParticles() {
-    pParticles.fill({});
-    uStartParticle = PARTICLES_ARRAY_SIZE;
-    uEndParticle = 0;
+    std::fill(pParticles.begin(), pParticles.end(), Particle());
+    // Sorted range is a valid min-heap.
+    _freeParticles.resize(pParticles.size());
+    std::iota(_freeParticles.begin(), _freeParticles.end(), 0);
+    _activeParticles.clear();
+    _activeParticlesSorted = true;
     uTimeElapsed = 0;
 }
 
 void ParticleEngine::AddParticle(Particle_sw *particle) {
-    if (!pMiscTimer->bPaused) {
-        Particle *freeParticle = nullptr;
-
-        for (int i = 0; i < pParticles.size(); i++) {
-            if (pParticles[i].type == ParticleType_Invalid) {
-                if (i < this->uStartParticle) {
-                    this->uStartParticle = i;
-                }
-                if (i > this->uEndParticle) {
-                    this->uEndParticle = i;
-                }
-                freeParticle = &pParticles[i];
-                break;
-            }
-        }
+    // Particles of invalid type used to take a slot & leave it free, so it's safe to just drop them.
+    if (pMiscTimer->bPaused || _freeParticles.empty() || particle->type == ParticleType_Invalid)
+        return;
 
-        if (freeParticle) {
-            freeParticle->type = particle->type;
-            freeParticle->x = particle->x;
-            freeParticle->y = particle->y;
-            freeParticle->z = particle->z;
-            freeParticle->_x = particle->x;
-            freeParticle->_y = particle->y;
-            freeParticle->_z = particle->z;
-            freeParticle->shift_x = particle->r; // TODO: seems Particle_sw struct fields are mixed up here
-            freeParticle->shift_y = particle->g;
-            freeParticle->shift_z = particle->b;
-            freeParticle->uParticleColor = particle->uDiffuse;
-            freeParticle->uLightColor_bgr = particle->uDiffuse;
-            // v6 = (v4->uType & 4) == 0;
-            freeParticle->timeToLive = particle->timeToLive;
-            freeParticle->texture = particle->texture;
-            freeParticle->paletteID = particle->paletteID;
-            freeParticle->particle_size = particle->particle_size;
-            if (freeParticle->type & ParticleType_Rotating) {
-                freeParticle->rotation_speed = vrng->random(256) - 128;
-                freeParticle->angle = vrng->random(TrigLUT.uIntegerDoublePi);
-            } else {
-                freeParticle->rotation_speed = 0;
-                freeParticle->angle = 0;
-            }
-        }
+    std::pop_heap(_freeParticles.begin(), _freeParticles.end(), std::greater<int>());
+    int index = _freeParticles.back();
+    _freeParticles.pop_back();
+
+    if (!_activeParticles.empty() && _activeParticles.back() > index)
+        _activeParticlesSorted = false;
+    _activeParticles.push_back(index);
+
+    Particle *freeParticle = &pParticles[index];
+    freeParticle->type = particle->type;
+    freeParticle->x = particle->x;
+    freeParticle->y = particle->y;
+    freeParticle->z = particle->z;
+    freeParticle->_x = particle->x;
+    freeParticle->_y = particle->y;
+    freeParticle->_z = particle->z;
+    freeParticle->shift_x = particle->r; // TODO: seems Particle_sw struct fields are mixed up here
+    freeParticle->shift_y = particle->g;
+    freeParticle->shift_z = particle->b;
+    freeParticle->uParticleColor = particle->uDiffuse;
+    freeParticle->uLightColor_bgr = particle->uDiffuse;
+    // v6 = (v4->uType & 4) == 0;
+    freeParticle->timeToLive = particle->timeToLive;
+    freeParticle->texture = particle->texture;
+    freeParticle->paletteID = particle->paletteID;
+    freeParticle->particle_size = particle->particle_size;
+    if (freeParticle->type & ParticleType_Rotating) {
+        freeParticle->rotation_speed = vrng->random(256) - 128;
+        freeParticle->angle = vrng->random(TrigLUT.uIntegerDoublePi);
+    } else {
+        freeParticle->rotation_speed = 0;
+        freeParticle->angle = 0;
     }
 }
 
+void ParticleEngine::sortActiveParticles() {
+    if (_activeParticlesSorted)
+        return;
+
+    std::sort(_activeParticles.begin(), _activeParticles.end());
+    _activeParticlesSorted = true;
+}
+
+void ParticleEngine::releaseParticle(int index) {
+    _freeParticles.push_back(index);
+    std::push_heap(_freeParticles.begin(), _freeParticles.end(), std::greater<int>());
+}
+
 void ParticleEngine::Draw() {
     uTimeElapsed += pEventTimer->uTimeElapsed;
     pLines.uNumLines = 0;
@@ -113,24 +134,24 @@ void ParticleEngine::Draw() {
 }
 
 void ParticleEngine::UpdateParticles() {
-    unsigned uCurrentEnd = 0;
-    unsigned uCurrentBegin = PARTICLES_ARRAY_SIZE;
     int time = pMiscTimer->bPaused == 0 ? pEventTimer->uTimeElapsed : 0;
 
     if (time == 0) {
         return;
     }
 
-    for (uint i = uStartParticle; i <= uEndParticle; ++i) {
-        Particle *p = &pParticles[i];
+    sortActiveParticles();
 
-        if (p->type == ParticleType_Invalid) {
-            continue;
-        }
+    // Expired particles are compacted out of the active list in place.
+    size_t aliveCount = 0;
+    for (size_t j = 0; j < _activeParticles.size(); ++j) {
+        int i = _activeParticles[j];
+        Particle *p = &pParticles[i];
 
         if (p->timeToLive <= time) {
             p->timeToLive = 0;
             p->type = ParticleType_Invalid;
+            releaseParticle(i);
             continue;
         }
 
@@ -177,16 +198,10 @@ void ParticleEngine::UpdateParticles() {
                              ((uint)floorf(p->g * dissipate_factor + 0.5) << 8) |
                              ((uint)floorf(p->r * dissipate_factor + 0.5) << 0);
 
-        if (i < uCurrentBegin) {
-           uCurrentBegin = i;
-        }
-        if (i > uCurrentEnd) {
-           uCurrentEnd = i;
-        }
+        _activeParticles[aliveCount++] = i;
     }
 
-    uEndParticle = uCurrentEnd;
-    uStartParticle = uCurrentBegin;
+    _activeParticles.resize(aliveCount);
 }
 
 bool ParticleEngine::ViewProject_TrueIfStillVisible_BLV(unsigned int uParticleID) {
@@ -233,10 +248,10 @@ void ParticleEngine::DrawParticles_BLV() {
 
     v15.sParentBillboardID = -1;
 
-    for (uint i = uStartParticle; i <= uEndParticle; ++i) {
-        Particle *p = &pParticles[i];
+    sortActiveParticles();
 
-        if (p->type == ParticleType_Invalid) continue;
+    for (int i : _activeParticles) {
+        Particle *p = &pParticles[i];
 
         if (!ViewProject_TrueIfStillVisible_BLV(i)) continue;
 
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <array>
+#include <vector>
 
 #include "Utility/Flags.h"
 
@@ -89,9 +89,15 @@ struct stru2_LineList {
     char field_604[60] {};
 };
 
+/**
+ * Particles live in a fixed-size pool. Free slots are kept in a min-heap, so spawning a particle doesn't need to scan
+ * the pool, but still takes the lowest free slot, same as the original code did. Live particles are tracked in a
+ * separate index list that's kept sorted by slot, so updating & drawing visits them in the same order as a full
+ * pool scan would.
+ */
 class ParticleEngine {
  public:
-    static const int PARTICLES_ARRAY_SIZE = 500;
+    static constexpr int DEFAULT_CAPACITY = 500;
 
     /**
      * Particle engine constructor.
@@ -100,6 +106,20 @@ class ParticleEngine {
      */
     ParticleEngine();
 
+    /**
+     * Resizes the particle pool, removing all active particles.
+     *
+     * @param capacity                  Max number of particles alive at the same time.
+     */
+    void setCapacity(int capacity);
+
+    /**
+     * @return                          Number of active particles.
+     */
+    [[nodiscard]] size_t activeParticleCount() const {
+        return _activeParticles.size();
+    }
+
     /**
      * Remove all active particles if any and initialize/reinitialize then particles engine.
      *
@@ -139,13 +159,17 @@ class ParticleEngine {
      */
     void DrawParticles_BLV();
 
-    std::array<Particle, PARTICLES_ARRAY_SIZE> pParticles;
+    std::vector<Particle> pParticles;
     stru2_LineList pLines;
-    char field_D160[4800]; // unused
-    float field_E420; // unused
-    int uStartParticle;
-    int uEndParticle;
     int uTimeElapsed;
+
+ private:
+    void sortActiveParticles();
+    void releaseParticle(int index);
+
+    std::vector<int> _freeParticles; // Min-heap of free slots in `pParticles`.
+    std::vector<int> _activeParticles; // Slots of active particles.
+    bool _activeParticlesSorted = true;
 };
 
 struct TrailParticle {
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <algorithm>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/MM7.h"
@@ -27,10 +28,21 @@
 #include "Engine/Graphics/PCX.h"
 
 #include "Utility/Math/TrigLut.h"
+#include "Utility/Memory/MemSet.h"
+#include "Utility/RadixSort.h"
 #include "Library/Random/Random.h"
 
 
 
+std::vector<RenderBillboard> pBillboardRenderList;
+unsigned int uNumBillboardsToDraw;
+
+RenderBillboard &AddBillboard() {
+    if (uNumBillboardsToDraw == pBillboardRenderList.size())
+        pBillboardRenderList.emplace_back();
+    return pBillboardRenderList[uNumBillboardsToDraw++];
+}
+
 bool RenderBase::Initialize() {
     window->resize({config->window.Width.value(), config->window.Height.value()});
 
@@ -44,77 +56,31 @@ bool RenderBase::Initialize() {
     return true;
 }
 
-unsigned int RenderBase::Billboard_ProbablyAddToListAndSortByZOrder(float z) {
-    if (uNumBillboardsToDraw >= 999) {
-        return 0;
-    }
-
-    if (!uNumBillboardsToDraw) {
-        uNumBillboardsToDraw = 1;
-        return 0;
-    }
-
-    unsigned int v7 = 0;
-    for (int left = 0, right = uNumBillboardsToDraw;
-         left < right;) {  // binsearch
-        v7 = left + (right - left) / 2;
-        if (z <= render->pBillboardRenderListD3D[v7].z_order)
-            right = v7;
-        else
-            left = v7 + 1;
-    }
-
-    if (z > render->pBillboardRenderListD3D[v7].z_order) {
-        if (v7 == render->uNumBillboardsToDraw - 1) {
-            v7 = render->uNumBillboardsToDraw;
-        } else {
-            if (render->uNumBillboardsToDraw > v7) {
-                for (unsigned int i = 0; i < render->uNumBillboardsToDraw - v7;
-                     i++) {
-                    memcpy(&render->pBillboardRenderListD3D
-                                [render->uNumBillboardsToDraw - i],
-                           &render->pBillboardRenderListD3D
-                                [render->uNumBillboardsToDraw - (i + 1)],
-                           sizeof(render->pBillboardRenderListD3D
-                                      [render->uNumBillboardsToDraw - i]));
-                }
-            }
-            ++v7;
-        }
-        uNumBillboardsToDraw++;
-        return v7;
-    }
-
-    if (z <= render->pBillboardRenderListD3D[v7].z_order) {
-        if (render->uNumBillboardsToDraw > v7) {
-            for (unsigned int i = 0; i < render->uNumBillboardsToDraw - v7;
-                 i++) {
-                memcpy(&render->pBillboardRenderListD3D
-                            [render->uNumBillboardsToDraw - i],
-                       &render->pBillboardRenderListD3D
-                            [render->uNumBillboardsToDraw - (i + 1)],
-                       sizeof(render->pBillboardRenderListD3D
-                                  [render->uNumBillboardsToDraw - i]));
-            }
-        }
-        uNumBillboardsToDraw++;
-        return v7;
-    }
-
-    return v7;
+RenderBillboardD3D *RenderBase::AddBillboardD3D() {
+    if (uNumBillboardsToDraw == pBillboardRenderListD3D.size())
+        pBillboardRenderListD3D.emplace_back();
+    return &pBillboardRenderListD3D[uNumBillboardsToDraw++];
 }
 
+void RenderBase::SortBillboardsD3D() {
+    // Keys are collected in reverse, so that billboards with equal z end up in reverse insertion order. This is what
+    // the original code did by inserting each new billboard in front of all the equal ones, and picking depends on it.
+    size_t size = uNumBillboardsToDraw;
+    _billboardSortKeys.resize(size);
+    for (size_t i = 0; i < size; i++)
+        _billboardSortKeys[i] = radixSortKey(pBillboardRenderListD3D[size - 1 - i].z_order);
+    radixSortOrder(_billboardSortKeys, &_billboardSortOrder, &_billboardSortScratch);
+
+    _billboardSortBuffer.resize(size);
+    for (size_t i = 0; i < size; i++)
+        _billboardSortBuffer[i] = pBillboardRenderListD3D[size - 1 - _billboardSortOrder[i]];
+    std::copy(_billboardSortBuffer.begin(), _billboardSortBuffer.end(), pBillboardRenderListD3D.begin());
+}
 
 // TODO: Move this to sprites ?
 // combined with IndoorLocation::PrepareItemsRenderList_BLV() (0044028F)
 void RenderBase::DrawSpriteObjects() {
     for (unsigned int i = 0; i < pSpriteObjects.size(); ++i) {
-        // exit if we are at max sprites
-        if (::uNumBillboardsToDraw >= 500) {
-            logger->warning("Billboards Full");
-            break;
-        }
-
         SpriteObject *object = &pSpriteObjects[i];
         if (!object->uObjectDescID) {  // item probably pciked up - this also gets wiped at end of sprite anims/ particle effects
             continue;
@@ -156,7 +122,6 @@ void RenderBase::DrawSpriteObjects() {
             unsigned int angle = TrigLUT.atan2(x - pCamera3D->vCameraPos.x, y - pCamera3D->vCameraPos.y);
             int octant = ((TrigLUT.uIntegerPi + (TrigLUT.uIntegerPi >> 3) + object->uFacing - angle) >> 8) & 7;
 
-            pBillboardRenderList[::uNumBillboardsToDraw].hwsprite = frame->hw_sprites[octant];
             // error catching
             if (frame->hw_sprites[octant]->texture->GetHeight() == 0 || frame->hw_sprites[octant]->texture->GetWidth() == 0) {
                 logger->verbose("Trying to draw sprite with empty octant texture");
@@ -207,28 +172,28 @@ void RenderBase::DrawSpriteObjects() {
                         projected_x - screen_space_half_width <= (signed int)pViewport->uViewportBR_X) {
                         if (projected_y >= pViewport->uViewportTL_Y && (projected_y - screen_space_height) <= pViewport->uViewportBR_Y) {
                             object->uAttributes |= SPRITE_VISIBLE;
-                            pBillboardRenderList[::uNumBillboardsToDraw].uPaletteIndex = frame->GetPaletteIndex();
-                            pBillboardRenderList[::uNumBillboardsToDraw].uIndoorSectorID = object->uSectorID;
-                            pBillboardRenderList[::uNumBillboardsToDraw].pSpriteFrame = frame;
+                            RenderBillboard &billboard = AddBillboard();
+                            billboard.hwsprite = frame->hw_sprites[octant];
+                            billboard.uPaletteIndex = frame->GetPaletteIndex();
+                            billboard.uIndoorSectorID = object->uSectorID;
+                            billboard.pSpriteFrame = frame;
 
-                            pBillboardRenderList[::uNumBillboardsToDraw].screenspace_projection_factor_x = billb_scale;
-                            pBillboardRenderList[::uNumBillboardsToDraw].screenspace_projection_factor_y = billb_scale;
+                            billboard.screenspace_projection_factor_x = billb_scale;
+                            billboard.screenspace_projection_factor_y = billb_scale;
 
-                            pBillboardRenderList[::uNumBillboardsToDraw].field_1E = setflags;
-                            pBillboardRenderList[::uNumBillboardsToDraw].world_x = x;
-                            pBillboardRenderList[::uNumBillboardsToDraw].world_y = y;
-                            pBillboardRenderList[::uNumBillboardsToDraw].world_z = z;
+                            billboard.field_1E = setflags;
+                            billboard.world_x = x;
+                            billboard.world_y = y;
+                            billboard.world_z = z;
 
-                            pBillboardRenderList[::uNumBillboardsToDraw].screen_space_x = projected_x;
-                            pBillboardRenderList[::uNumBillboardsToDraw].screen_space_y = projected_y;
-                            pBillboardRenderList[::uNumBillboardsToDraw].screen_space_z = view_x;
+                            billboard.screen_space_x = projected_x;
+                            billboard.screen_space_y = projected_y;
+                            billboard.screen_space_z = view_x;
 
-                            pBillboardRenderList[::uNumBillboardsToDraw].object_pid = PID(OBJECT_Item, i);
-                            pBillboardRenderList[::uNumBillboardsToDraw].dimming_level = 0;
-                            pBillboardRenderList[::uNumBillboardsToDraw].sTintColor = 0;
+                            billboard.object_pid = PID(OBJECT_Item, i);
+                            billboard.dimming_level = 0;
+                            billboard.sTintColor = 0;
 
-                            assert(::uNumBillboardsToDraw < 500);
-                            ++::uNumBillboardsToDraw;
                             ++uNumSpritesDrawnThisFrame;
                         }
                     }
@@ -251,11 +216,6 @@ void RenderBase::PrepareDecorationsRenderList_ODM() {
     int v38;                // [sp+88h] [bp-1Ch]@9
 
     for (unsigned int i = 0; i < pLevelDecorations.size(); ++i) {
-        if (::uNumBillboardsToDraw >= 500) {
-            logger->warning("Billboards Full");
-            return;
-        }
-
         // view cull
         if (!IsCylinderInFrustum(pLevelDecorations[i].vPosition.toFloat(), 512.0f)) continue;
 
@@ -350,7 +310,7 @@ void RenderBase::PrepareDecorationsRenderList_ODM() {
                             if (projected_x + screen_space_half_width >= (signed int)pViewport->uViewportTL_X &&
                                 projected_x - screen_space_half_width <= (signed int)pViewport->uViewportBR_X) {
                                 if (projected_y >= pViewport->uViewportTL_Y && (projected_y - screen_space_height) <= pViewport->uViewportBR_Y) {
-                                    ::uNumBillboardsToDraw++;
+                                    AddBillboard();
                                     ++uNumDecorationsDrawnThisFrame;
 
                                     pBillboardRenderList[::uNumBillboardsToDraw - 1].hwsprite = frame->hw_sprites[(int64_t)v37];
@@ -440,8 +400,7 @@ void RenderBase::TransformBillboard(SoftwareBillboard *pSoftBillboard, RenderBil
     if (pSprite->texture->GetHeight() == 0 || pSprite->texture->GetWidth() == 0)
         __debugbreak();
 
-    unsigned int billboard_index = Billboard_ProbablyAddToListAndSortByZOrder(pSoftBillboard->screen_space_z);
-    RenderBillboardD3D *billboard = &pBillboardRenderListD3D[billboard_index];
+    RenderBillboardD3D *billboard = AddBillboardD3D();
 
     float scr_proj_x = pSoftBillboard->screenspace_projection_factor_x;
     float scr_proj_y = pSoftBillboard->screenspace_projection_factor_y;
@@ -536,8 +495,7 @@ void RenderBase::MakeParticleBillboardAndPush(SoftwareBillboard *a2,
                                                   Texture *texture,
                                                   unsigned int uDiffuse,
                                                   int angle) {
-    unsigned int billboard_index = Billboard_ProbablyAddToListAndSortByZOrder(a2->screen_space_z);
-    RenderBillboardD3D *billboard = &pBillboardRenderListD3D[billboard_index];
+    RenderBillboardD3D *billboard = AddBillboardD3D();
 
     billboard->opacity = RenderBillboardD3D::Opaque_1;
     billboard->field_90 = a2->field_44;
@@ -706,23 +664,24 @@ void RenderBase::BillboardSphereSpellFX(struct SpellFX_Billboard *a1, int diffus
         }
     }
 
-    unsigned int v5 = Billboard_ProbablyAddToListAndSortByZOrder(depth);
-    pBillboardRenderListD3D[v5].field_90 = 0;
-    pBillboardRenderListD3D[v5].sParentBillboardID = -1;
-    pBillboardRenderListD3D[v5].opacity = RenderBillboardD3D::Opaque_2;
-    pBillboardRenderListD3D[v5].texture = 0;
-    pBillboardRenderListD3D[v5].uNumVertices = a1->uNumVertices;
-    pBillboardRenderListD3D[v5].z_order = depth;
-    pBillboardRenderListD3D[v5].PaletteIndex = 0;
+    RenderBillboardD3D *billboard = AddBillboardD3D();
+    billboard->field_90 = 0;
+    billboard->object_pid = 0;
+    billboard->sParentBillboardID = -1;
+    billboard->opacity = RenderBillboardD3D::Opaque_2;
+    billboard->texture = 0;
+    billboard->uNumVertices = a1->uNumVertices;
+    billboard->z_order = depth;
+    billboard->PaletteIndex = 0;
 
-    pBillboardRenderListD3D[v5].pQuads[3].pos.x = 0.0f;
-    pBillboardRenderListD3D[v5].pQuads[3].pos.y = 0.0f;
-    pBillboardRenderListD3D[v5].pQuads[3].pos.z = 0.0f;
+    billboard->pQuads[3].pos.x = 0.0f;
+    billboard->pQuads[3].pos.y = 0.0f;
+    billboard->pQuads[3].pos.z = 0.0f;
 
     for (unsigned int i = 0; i < (unsigned int)a1->uNumVertices; ++i) {
-        pBillboardRenderListD3D[v5].pQuads[i].pos.x = a1->field_104[i].x;
-        pBillboardRenderListD3D[v5].pQuads[i].pos.y = a1->field_104[i].y;
-        pBillboardRenderListD3D[v5].pQuads[i].pos.z = a1->field_104[i].z;
+        billboard->pQuads[i].pos.x = a1->field_104[i].x;
+        billboard->pQuads[i].pos.y = a1->field_104[i].y;
+        billboard->pQuads[i].pos.z = a1->field_104[i].z;
 
         float rhw = 1.f / a1->field_104[i].z;
         float z = 1.f - 1.f / (a1->field_104[i].z * 1000.f / pCamera3D->GetFarClip());
@@ -730,7 +689,7 @@ void RenderBase::BillboardSphereSpellFX(struct SpellFX_Billboard *a1, int diffus
         double v10 = a1->field_104[i].z;
         v10 *= 1000.f / pCamera3D->GetFarClip();
 
-        pBillboardRenderListD3D[v5].pQuads[i].rhw = rhw;
+        billboard->pQuads[i].rhw = rhw;
 
         int v12;
         if (diffuse & 0xFF000000) {
@@ -738,11 +697,11 @@ void RenderBase::BillboardSphereSpellFX(struct SpellFX_Billboard *a1, int diffus
         } else {
             v12 = diffuse;
         }
-        pBillboardRenderListD3D[v5].pQuads[i].diffuse = v12;
-        pBillboardRenderListD3D[v5].pQuads[i].specular = 0;
+        billboard->pQuads[i].diffuse = v12;
+        billboard->pQuads[i].specular = 0;
 
-        pBillboardRenderListD3D[v5].pQuads[i].texcoord.x = 0.5;
-        pBillboardRenderListD3D[v5].pQuads[i].texcoord.y = 0.5;
+        billboard->pQuads[i].texcoord.x = 0.5;
+        billboard->pQuads[i].texcoord.y = 0.5;
     }
 }
 
@@ -770,6 +729,7 @@ void RenderBase::DrawSpecialEffectsQuad(Texture *texture, int palette) {
 
 void RenderBase::DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene() {
     engine->draw_debug_outlines();
+    SortBillboardsD3D();
     render->DoRenderBillboards_D3D();
     spell_fx_renderer->RenderSpecialEffects();
 }
@@ -779,3 +739,125 @@ void RenderBase::PresentBlackScreen() {
     ClearBlack();
     Present();
 }
+
+// TODO(pskelton): z buffer must go
+void RenderBase::CreateZBuffer() {
+    Sizei outputRender = GetRenderDimensions();
+
+    if (pActiveZBuffer)
+        free(pActiveZBuffer);
+
+    pActiveZBuffer = (int*)malloc(outputRender.w * outputRender.h * sizeof(int));
+    if (!pActiveZBuffer)
+        Error("Failed to create zbuffer");
+
+    ClearZBuffer();
+}
+
+// TODO(pskelton): z buffer must go
+void RenderBase::ClearZBuffer() {
+    Sizei outputRender = GetRenderDimensions();
+    memset32(this->pActiveZBuffer, 0xFFFF0000, outputRender.w * outputRender.h);
+}
+
+void RenderBase::ZDrawTextureAlpha(float u, float v, Image *img, int zVal) {
+    if (!img) return;
+
+    Sizei outputRender = GetRenderDimensions();
+    int uOutX = static_cast<int>(u * outputRender.w);
+    int uOutY = static_cast<int>(v * outputRender.h);
+    int imgheight = img->GetHeight();
+    int imgwidth = img->GetWidth();
+    auto pixels = (uint32_t *)img->GetPixels(IMAGE_FORMAT_A8B8G8R8);
+
+    if (uOutX < 0)
+        uOutX = 0;
+    if (uOutY < 0)
+        uOutY = 0;
+
+    for (int xs = 0; xs < imgwidth; xs++) {
+        for (int ys = 0; ys < imgheight; ys++) {
+            if (pixels[xs + imgwidth * ys] & 0xFF000000) {
+                this->pActiveZBuffer[uOutX + xs + outputRender.w * (uOutY + ys)] = zVal;
+            }
+        }
+    }
+}
+
+// TODO: should this be combined / moved out of render
+std::vector<Actor*> RenderBase::getActorsInViewport(int pDepth) {
+    std::vector<Actor*> foundActors;
+
+    for (int i = 0; i < render->uNumBillboardsToDraw; i++) {
+        int renderId = render->pBillboardRenderListD3D[i].sParentBillboardID;
+        if(renderId == -1) {
+            continue; // E.g. spell particle.
+        }
+
+        int pid = pBillboardRenderList[renderId].object_pid;
+        if (PID_TYPE(pid) == OBJECT_Actor) {
+            if (pBillboardRenderList[renderId].screen_space_z <= pDepth) {
+                int id = PID_ID(pid);
+                if (pActors[id].uAIState != Dead &&
+                    pActors[id].uAIState != Dying &&
+                    pActors[id].uAIState != Removed &&
+                    pActors[id].uAIState != Disabled &&
+                    pActors[id].uAIState != Summoned) {
+                    if (vis->DoesRayIntersectBillboard(static_cast<float>(pDepth), i)) {
+                        // Limit for 100 actors was removed
+                        foundActors.push_back(&pActors[id]);
+                    }
+                }
+            }
+        }
+    }
+    return foundActors;
+}
+
+void RenderBase::UpdateGameViewport() {
+    Sizei outputRender = GetRenderDimensions();
+
+    game_viewport_x = viewparams->uScreen_topL_X = engine->config->graphics.ViewPortX1.value(); //8
+    game_viewport_y = viewparams->uScreen_topL_Y = engine->config->graphics.ViewPortY1.value(); //8
+    game_viewport_z = viewparams->uScreen_BttmR_X = outputRender.w - engine->config->graphics.ViewPortX2.value(); //468;
+    game_viewport_w = viewparams->uScreen_BttmR_Y = outputRender.h - engine->config->graphics.ViewPortY2.value(); //352;
+
+    game_viewport_width = game_viewport_z - game_viewport_x;
+    game_viewport_height = game_viewport_w - game_viewport_y;
+
+    viewparams->uSomeY = viewparams->uScreen_topL_Y;
+    viewparams->uSomeX = viewparams->uScreen_topL_X;
+    viewparams->uSomeZ = viewparams->uScreen_BttmR_X;
+    viewparams->uSomeW = viewparams->uScreen_BttmR_Y;
+
+    pViewport->SetScreen(viewparams->uScreen_topL_X, viewparams->uScreen_topL_Y,
+                        viewparams->uScreen_BttmR_X,
+                        viewparams->uScreen_BttmR_Y);
+}
+
+void RenderBase::MarkIndoorFacesSeenByParty() {
+    // Same checks as in RenderOpenGL::DrawIndoorFaces.
+    static RenderVertexSoft static_vertices_buff_in[64];
+    static RenderVertexSoft static_vertices_calc_out[64];
+
+    for (uint i = 0; i < pBspRenderer->num_faces; ++i) {
+        unsigned int uFaceID = pBspRenderer->faces[i].uFaceID;
+        if (uFaceID >= pIndoor->pFaces.size())
+            continue;
+        BLVFace *face = &pIndoor->pFaces[uFaceID];
+
+        if (face->Portal() || face->uNumVertices < 3 || face->Invisible() || !face->GetTexture())
+            continue;
+
+        if (face->Indoor_sky() && face->uPolygonType != POLYGON_InBetweenFloorAndWall && face->uPolygonType != POLYGON_Floor)
+            continue;
+
+        unsigned int uNumVertices = face->uNumVertices;
+        for (uint j = 0; j < face->uNumVertices; ++j)
+            static_vertices_buff_in[j].vWorldPosition = pIndoor->pVertices[face->pVertexIDs[j]].toFloat();
+
+        IndoorCameraD3D_Vec4 *portalfrustumnorm = pBspRenderer->nodes[pBspRenderer->faces[i].uNodeID].ViewportNodeFrustum.data();
+        if (pCamera3D->CullFaceToFrustum(static_vertices_buff_in, &uNumVertices, static_vertices_calc_out, portalfrustumnorm, 4))
+            face->uAttributes |= FACE_SeenByParty;
+    }
+}
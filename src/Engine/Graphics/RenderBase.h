@@ -1,6 +1,8 @@
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Engine/Graphics/HWLContainer.h"
 #include "Engine/Graphics/IRender.h"
@@ -55,10 +57,46 @@ class RenderBase : public IRender {
     virtual void DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene() override;
     virtual void PresentBlackScreen() override;
 
+    virtual void CreateZBuffer() override;
+    virtual void ClearZBuffer() override;
+    virtual void ZDrawTextureAlpha(float u, float v, Image *pTexture, int zVal) override;
+    virtual std::vector<Actor*> getActorsInViewport(int pDepth) override;
+
+    /**
+     * Appends a billboard to `pBillboardRenderListD3D`, growing the list if needed. The list is not kept sorted, see
+     * `SortBillboardsD3D`.
+     *
+     * @return                          New billboard. Entries are reused between frames, so all the fields need to be
+     *                                  filled in by the caller.
+     */
+    RenderBillboardD3D *AddBillboardD3D();
+
+    /**
+     * Sorts `pBillboardRenderListD3D` by `z_order`, ascending. Billboards with equal `z_order` end up in reverse
+     * insertion order. Called once a frame, before the billboards are drawn.
+     */
+    void SortBillboardsD3D();
+
  protected:
-    unsigned int Billboard_ProbablyAddToListAndSortByZOrder(float z);
     void TransformBillboard(SoftwareBillboard *a2, RenderBillboard *pBillboard);
 
+    /**
+     * Recalculates game viewport & `viewparams` for the current render dimensions, should be called after a resize.
+     */
+    void UpdateGameViewport();
+
+    /**
+     * Marks indoor faces that are visible through the portals with `FACE_SeenByParty`. This is the only part of indoor
+     * drawing that affects the game state, as the marked faces show up on the automap.
+     */
+    void MarkIndoorFacesSeenByParty();
+
     HWLContainer pD3DBitmaps;
     HWLContainer pD3DSprites;
+
+ private:
+    std::vector<uint32_t> _billboardSortKeys;
+    std::vector<uint32_t> _billboardSortOrder;
+    std::vector<uint32_t> _billboardSortScratch;
+    std::vector<RenderBillboardD3D> _billboardSortBuffer;
 };
@@ -2,5 +2,6 @@
 
 enum class RendererType {
     OpenGL,
-    OpenGLES
+    OpenGLES,
+    Null // Doesn't draw anything, for headless trace playback.
 };
@@ -0,0 +1,116 @@
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/ObjectList.h"
+#include "Engine/Objects/SpriteObject.h"
+
+static constexpr int GRID_SIZE = 128;
+
+SpatialGrid actorGrid;
+SpatialGrid spriteObjectGrid;
+
+static int gridCoord(float pos) {
+    // Clamp first so that the conversion doesn't overflow, anything this far is way out of the grid anyway.
+    return static_cast<int>(std::floor(std::clamp(pos, -1048576.0f, 1048576.0f)));
+}
+
+SpatialGrid::SpatialGrid() : _cells(GRID_SIZE * GRID_SIZE) {}
+
+void SpatialGrid::clear() {
+    for (std::vector<int> &cell : _cells)
+        cell.clear();
+    _entries.clear();
+    _maxRadius = 0;
+}
+
+void SpatialGrid::update(int id, const Vec3i &pos, int radius) {
+    assert(id >= 0);
+
+    _maxRadius = std::max(_maxRadius, radius);
+
+    if (id >= _entries.size())
+        _entries.resize(id + 1);
+
+    Entry &entry = _entries[id];
+    int cell = WorldPosToGridCellXClamped(pos.x) + WorldPosToGridCellYClamped(pos.y) * GRID_SIZE;
+    if (entry.cell == cell)
+        return;
+
+    if (entry.cell != -1) {
+        std::vector<int> &oldCell = _cells[entry.cell];
+        int lastId = oldCell.back();
+        oldCell[entry.slot] = lastId;
+        _entries[lastId].slot = entry.slot;
+        oldCell.pop_back();
+    }
+
+    entry.cell = cell;
+    entry.slot = _cells[cell].size();
+    _cells[cell].push_back(id);
+}
+
+void SpatialGrid::query(const BBoxf &bbox, float margin, std::vector<int> *result) const {
+    result->clear();
+
+    int x1 = WorldPosToGridCellXClamped(gridCoord(bbox.x1 - margin));
+    int x2 = WorldPosToGridCellXClamped(gridCoord(bbox.x2 + margin));
+    int y1 = WorldPosToGridCellYClamped(gridCoord(bbox.y2 + margin)); // Grid Y axis is flipped.
+    int y2 = WorldPosToGridCellYClamped(gridCoord(bbox.y1 - margin));
+
+    for (int y = y1; y <= y2; y++)
+        for (int x = x1; x <= x2; x++)
+            for (int id : _cells[x + y * GRID_SIZE])
+                result->push_back(id);
+
+    std::sort(result->begin(), result->end());
+}
+
+// Makes sure the grid covers exactly the ids in [0, count), entities that were added since the last refresh are
+// inserted, and if the array has shrunk (e.g. a new level was loaded), the grid is rebuilt from scratch. Returns the
+// number of ids that were already in the grid and weren't updated.
+template<class Update>
+static size_t syncGridSize(SpatialGrid *grid, size_t count, Update update) {
+    if (grid->size() > count)
+        grid->clear();
+    size_t result = grid->size();
+    for (int i = result; i < count; i++)
+        update(i);
+    return result;
+}
+
+void RefreshSpatialGrids() {
+    size_t actorCount = syncGridSize(&actorGrid, pActors.size(), &UpdateActorInSpatialGrid);
+    for (int i = 0; i < actorCount; i++)
+        UpdateActorInSpatialGrid(i);
+
+    size_t spriteObjectCount = syncGridSize(&spriteObjectGrid, pSpriteObjects.size(), &UpdateSpriteObjectInSpatialGrid);
+    for (int i = 0; i < spriteObjectCount; i++)
+        UpdateSpriteObjectInSpatialGrid(i);
+}
+
+void UpdateActorInSpatialGrid(int actorId) {
+    const Actor &actor = pActors[actorId];
+    actorGrid.update(actorId, actor.vPosition, actor.uActorRadius);
+}
+
+void UpdateSpriteObjectInSpatialGrid(int spriteObjectId) {
+    // Free slots are also tracked, these are skipped by the collision code anyway.
+    const SpriteObject &object = pSpriteObjects[spriteObjectId];
+    int radius = object.uObjectDescID ? pObjectList->pObjects[object.uObjectDescID].uRadius : 0;
+    spriteObjectGrid.update(spriteObjectId, object.vPosition, radius);
+}
+
+void FindActorsNear(const BBoxf &bbox, int radius, std::vector<int> *result) {
+    syncGridSize(&actorGrid, pActors.size(), &UpdateActorInSpatialGrid);
+    actorGrid.query(bbox, radius ? radius : actorGrid.maxRadius(), result);
+}
+
+void FindSpriteObjectsNear(const BBoxf &bbox, std::vector<int> *result) {
+    syncGridSize(&spriteObjectGrid, pSpriteObjects.size(), &UpdateSpriteObjectInSpatialGrid);
+    spriteObjectGrid.query(bbox, spriteObjectGrid.maxRadius(), result);
+}
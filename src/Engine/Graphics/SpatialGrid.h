@@ -0,0 +1,92 @@
+#pragma once
+
+#include <vector>
+
+#include "Utility/Geometry/BBox.h"
+#include "Utility/Geometry/Vec.h"
+
+/**
+ * Uniform grid over the level's XY plane that maps grid cells to ids of the entities inside them.
+ *
+ * Cells are the same as the outdoor terrain cells, see `WorldPosToGridCellX` & `WorldPosToGridCellY`. Indoor levels
+ * use the same grid, positions outside of the 128x128 cell area are clamped to border cells.
+ *
+ * Each entity is stored only in the cell that contains its center, so queries need to be extended by the max entity
+ * radius. The grid tracks this radius, see `maxRadius`.
+ */
+class SpatialGrid {
+ public:
+    SpatialGrid();
+
+    void clear();
+
+    /**
+     * Inserts an entity into the grid, or moves it into a new cell if it's already there.
+     *
+     * @param id                        Entity id. Ids are expected to be small dense integers, e.g. indices in
+     *                                  `pActors`.
+     * @param pos                       Entity position.
+     * @param radius                    Entity radius.
+     */
+    void update(int id, const Vec3i &pos, int radius);
+
+    /**
+     * @return                          Number of ids this grid was populated with, i.e. max id plus one.
+     */
+    [[nodiscard]] size_t size() const {
+        return _entries.size();
+    }
+
+    /**
+     * @return                          Largest entity radius that was passed to `update` since the last `clear`.
+     */
+    [[nodiscard]] int maxRadius() const {
+        return _maxRadius;
+    }
+
+    /**
+     * @param bbox                      Bounding box to look up, only XY coordinates are used.
+     * @param margin                    Additional margin to extend `bbox` by, usually `maxRadius()`.
+     * @param[out] result               Ids of entities that have their centers inside the extended box, and maybe some
+     *                                  more that are close to it. Sorted in ascending order, so that iterating over
+     *                                  the result visits the entities in the same order as a plain loop over
+     *                                  all ids would.
+     */
+    void query(const BBoxf &bbox, float margin, std::vector<int> *result) const;
+
+ private:
+    struct Entry {
+        int cell = -1;
+        int slot = -1; // Position in `_cells[cell]`.
+    };
+
+    std::vector<std::vector<int>> _cells;
+    std::vector<Entry> _entries;
+    int _maxRadius = 0;
+};
+
+extern SpatialGrid actorGrid; // Indexed by actor id.
+extern SpatialGrid spriteObjectGrid; // Indexed by sprite object id.
+
+/**
+ * Syncs `actorGrid` & `spriteObjectGrid` with `pActors` & `pSpriteObjects`. Movement code updates the grids as
+ * entities move, this function catches up on all the other position changes (level loading, teleports, spawns), and
+ * is called once a frame.
+ */
+void RefreshSpatialGrids();
+
+void UpdateActorInSpatialGrid(int actorId);
+void UpdateSpriteObjectInSpatialGrid(int spriteObjectId);
+
+/**
+ * @param bbox                          Bounding box to look up, only XY coordinates are used.
+ * @param radius                        Radius that the actors will be checked with, zero means actors' own radii.
+ * @param[out] result                   Ids of actors that might intersect `bbox`, sorted in ascending order.
+ */
+void FindActorsNear(const BBoxf &bbox, int radius, std::vector<int> *result);
+
+/**
+ * @param bbox                          Bounding box to look up, only XY coordinates are used.
+ * @param[out] result                   Ids of sprite objects that might intersect `bbox`, sorted in ascending order.
+ */
+void FindSpriteObjectsNear(const BBoxf &bbox, std::vector<int> *result);
@@ -1,9 +1,18 @@
 #include "Engine/LOD.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "Library/Compression/Compression.h"
+#include "Library/Lod/LodReader.h"
+#include "Library/Logger/Logger.h"
+#include "Library/Profiler/Profiler.h"
+#include "Library/Snapshot/SnapshotReader.h"
+#include "Library/Snapshot/SnapshotWriter.h"
 
 #include "Engine/Engine.h"
 
@@ -11,7 +20,9 @@
 #include "Engine/Graphics/IRender.h"
 #include "Engine/Graphics/Sprites.h"
 
+#include "Utility/Exception.h"
 #include "Utility/Memory/FreeDeleter.h"
+#include "Utility/ThreadPool.h"
 
 LODFile_IconsBitmaps *pEvents_LOD = nullptr;
 
@@ -30,6 +41,9 @@ LODFile_Sprites *pSprites_LOD_mm8 = nullptr;
 LOD::WriteableFile *pSave_LOD = nullptr; // LOD pointing to the savegame file currently being processed
 LOD::File *pGames_LOD = nullptr; // LOD pointing to data/games.lod
 
+static std::unique_ptr<LodReader> gamesLodReader; // Same games.lod, used for batched reads when loading maps.
+static std::unique_ptr<ThreadPool> gamesLodPool; // Created lazily, on first batched read.
+
 int _6A0CA4_lod_binary_search;
 int _6A0CA8_lod_unused;
 
@@ -40,9 +54,15 @@ struct FileCloser {
     }
 };
 
+static std::string_view textureName(const Texture_MM7 &texture) {
+    // Names are strncpy'd into the header, so they might not be null-terminated.
+    return std::string_view(texture.header.pName, strnlen(texture.header.pName, sizeof(texture.header.pName)));
+}
+
 inline int LODFile_IconsBitmaps::LoadDummyTexture() {
-    for (unsigned int i = 0; i < uNumLoadedFiles; ++i)
-        if (!strcmp(pTextures[i].header.pName, "pending")) return i;
+    int index = _findLoadedTexture("pending");
+    if (index != -1)
+        return index;
     return LoadTextureFromLOD(&pTextures[uNumLoadedFiles], "pending",
                               TEXTURE_24BIT_PALETTE);
 }
@@ -81,6 +101,7 @@ void LODFile_IconsBitmaps::RemoveTexturesFromTextureList() {
         this->uNumLoadedFiles = this->uNumPrevLoadedFiles;
         this->uNumPrevLoadedFiles = 0;
         this->uTexturePacksCount = 0;
+        _trimTextureIndex();
     }
 }
 
@@ -96,10 +117,40 @@ void LODFile_IconsBitmaps::RemoveTexturesPackFromTextureList() {
             }
             this->uNumLoadedFiles = this->uNumPrevLoadedFiles;
             this->uNumPrevLoadedFiles = 0;
+            _trimTextureIndex();
         }
     }
 }
 
+int LODFile_IconsBitmaps::_findLoadedTexture(std::string_view name) {
+    auto pos = _textureIndexByName.find(name);
+    if (pos == _textureIndexByName.end())
+        return -1;
+
+    int index = pos->second;
+    if (index >= static_cast<int>(uNumLoadedFiles) || !iequals(textureName(pTextures[index]), name)) {
+        _textureIndexByName.erase(pos); // Stale, the texture was released.
+        return -1;
+    }
+
+    return index;
+}
+
+void LODFile_IconsBitmaps::_indexLoadedTexture(int index) {
+    std::string_view name = textureName(pTextures[index]);
+
+    // If there already is a valid entry for this name then it points to a lower index, and a linear search over
+    // pTextures would return that one, so we keep it.
+    if (_findLoadedTexture(name) == -1)
+        _textureIndexByName.emplace(name, index);
+}
+
+void LODFile_IconsBitmaps::_trimTextureIndex() {
+    std::erase_if(_textureIndexByName, [this](const auto &pair) {
+        return pair.second >= static_cast<int>(uNumLoadedFiles);
+    });
+}
+
 #pragma pack(push, 1)
 struct LODSpriteLine {
     int16_t begin;
@@ -148,11 +199,9 @@ bool LODFile_Sprites::Load(const std::string &pFilename, const std::string &fold
 }
 
 int LODFile_Sprites::LoadSprite(const char *pContainerName, unsigned int uPaletteID) {
-    for (int i = 0; i < uNumLoadedSprites; ++i) {
-        if (pHardwareSprites[i].pName == pContainerName) {
-            return i;
-        }
-    }
+    int index = _findLoadedSprite(pContainerName);
+    if (index != -1)
+        return index;
 
     if (uNumLoadedSprites >= MAX_LOD_SPRITES) return -1;
     // if not loaded - load from file
@@ -198,20 +247,41 @@ int LODFile_Sprites::LoadSprite(const char *pContainerName, unsigned int uPalett
         }
     }
 
+    _spriteIndexByName.insert_or_assign(pContainerName, uNumLoadedSprites);
+
     ++uNumLoadedSprites;
     return uNumLoadedSprites - 1;
 }
 
 Sprite *LODFile_Sprites::getSprite(std::string_view pContainerName) {
-    for (int i = 0; i < uNumLoadedSprites; ++i) {
-        if (pHardwareSprites[i].pName == pContainerName) {
-            return &pHardwareSprites[i];
-        }
-    }
+    int index = _findLoadedSprite(pContainerName);
+    if (index != -1)
+        return &pHardwareSprites[index];
+
     logger->warning("Sprite not found!");
     return nullptr;
 }
 
+int LODFile_Sprites::_findLoadedSprite(std::string_view name) {
+    auto pos = _spriteIndexByName.find(name);
+    if (pos == _spriteIndexByName.end())
+        return -1;
+
+    int index = pos->second;
+    if (index >= static_cast<int>(uNumLoadedSprites) || !iequals(pHardwareSprites[index].pName, name)) {
+        _spriteIndexByName.erase(pos); // Stale, the sprite was released.
+        return -1;
+    }
+
+    return index;
+}
+
+void LODFile_Sprites::_trimSpriteIndex() {
+    std::erase_if(_spriteIndexByName, [this](const auto &pair) {
+        return pair.second >= static_cast<int>(uNumLoadedSprites);
+    });
+}
+
 void LODFile_Sprites::ReleaseLostHardwareSprites() {}
 
 void LODFile_Sprites::ReleaseAll() {}
@@ -225,11 +295,13 @@ void LODFile_IconsBitmaps::ReleaseAll2() {
     this->uTexturePacksCount = 0;
     this->uNumPrevLoadedFiles = 0;
     this->uNumLoadedFiles = this->dword_11B84;
+    _trimTextureIndex();
 }
 
 void LODFile_Sprites::DeleteSomeOtherSprites() {
     DeleteSpritesRange(field_ECA0, uNumLoadedSprites);
     uNumLoadedSprites = field_ECA0;
+    _trimSpriteIndex();
 }
 
 void LOD::File::Close() {
@@ -244,6 +316,8 @@ void LOD::File::Close() {
     fclose(pFile);
     isFileOpened = false;
     _6A0CA8_lod_unused = 0;
+    pSnapshotReader.reset(); // Snapshots are tied to the LOD they were made from.
+    pSnapshotWriter.reset();
 }
 
 int LOD::WriteableFile::CreateNewLod(LOD::FileHeader *pHeader,
@@ -293,6 +367,7 @@ void LODFile_Sprites::DeleteSomeSprites() {
     int *v2 = &this->field_ECA8;
     DeleteSpritesRange(this->field_ECA8, this->uNumLoadedSprites);
     *v1 = *v2;
+    _trimSpriteIndex();
 }
 
 void LODFile_Sprites::DeleteSpritesRange(int uStartIndex, int uStopIndex) {
@@ -346,14 +421,11 @@ void LODFile_IconsBitmaps::ReleaseAll() {
     this->dword_11B84 = 0;
     this->dword_11B80 = 0;
     this->uNumLoadedFiles = 0;
+    _textureIndexByName.clear();
 }
 
 unsigned int LODFile_IconsBitmaps::FindTextureByName(const std::string &pName) {
-    for (uint i = 0; i < this->uNumLoadedFiles; i++) {
-        if (iequals(this->pTextures[i].header.pName, pName))
-            return i;
-    }
-    return -1;
+    return _findLoadedTexture(pName);
 }
 
 void LODFile_IconsBitmaps::SyncLoadedFilesCount() {
@@ -365,6 +437,7 @@ void LODFile_IconsBitmaps::SyncLoadedFilesCount() {
     if (loaded_files < (signed int)this->uNumLoadedFiles) {
         ++loaded_files;
         this->uNumLoadedFiles = loaded_files;
+        _trimTextureIndex();
     }
 }
 
@@ -522,6 +595,12 @@ void LOD::WriteableFile::CloseWriteFile() {
 }
 
 unsigned int LOD::WriteableFile::Write(const std::string &file_name, const void *pDirData, size_t size, int a4) {
+    if (isWriteInProgress) {
+        Assert(a4 == 0);
+        pPendingWrites.emplace_back(file_name, Blob::copy(pDirData, size));
+        return 0;
+    }
+
     LOD::Directory dir;
     strcpy(dir.pFilename, file_name.c_str());
     dir.uDataSize = size;
@@ -661,6 +740,121 @@ unsigned int LOD::WriteableFile::Write(const std::string &file_name, const Blob
     return Write(file_name, data.data(), data.size(), 0);
 }
 
+void LOD::WriteableFile::BeginWrite() {
+    Assert(!isWriteInProgress);
+    isWriteInProgress = true;
+}
+
+bool LOD::WriteableFile::CommitWrite(const std::string &copyPath) {
+    Assert(isWriteInProgress);
+    isWriteInProgress = false;
+    std::vector<std::pair<std::string, Blob>> writes = std::move(pPendingWrites);
+    pPendingWrites.clear();
+
+    if (!isFileOpened || !pSubIndices || !pIOBuffer || !uIOBufferSize)
+        return false;
+
+    // Entries without data are the ones already in the LOD, their directories still point into the current file.
+    struct Entry {
+        LOD::Directory dir;
+        const Blob *data = nullptr;
+    };
+    std::vector<Entry> entries;
+    for (size_t i = 0; i < uNumSubDirs; i++)
+        entries.push_back({pSubIndices[i]});
+
+    for (const auto &[name, data] : writes) {
+        Entry entry;
+        strcpy(entry.dir.pFilename, name.c_str());
+        entry.dir.uDataSize = data.size();
+        entry.data = &data;
+
+        // Same as in Write, replace the entry with the same name, or insert before the first one that's not less.
+        auto pos = std::find_if(entries.begin(), entries.end(), [&](const Entry &other) {
+            return !iless(other.dir.pFilename, entry.dir.pFilename);
+        });
+        if (pos != entries.end() && iequals(pos->dir.pFilename, entry.dir.pFilename)) {
+            *pos = entry;
+        } else {
+            entries.insert(pos, entry);
+        }
+    }
+    Assert(entries.size() <= 300);
+
+    std::vector<LOD::Directory> dirs;
+    size_t offset = sizeof(LOD::Directory) * entries.size();
+    for (const Entry &entry : entries) {
+        dirs.push_back(entry.dir);
+        dirs.back().uOfsetFromSubindicesStart = offset;
+        offset += entry.dir.uDataSize;
+    }
+
+    LOD::Directory Lindx;
+    strcpy(Lindx.pFilename, "chapter");
+    Lindx.dword_000018 = 0;
+    Lindx.priority = 0;
+    Lindx.uNumSubIndices = entries.size();
+    Lindx.uOfsetFromSubindicesStart = sizeof(LOD::FileHeader) + sizeof(LOD::Directory);
+    Lindx.uDataSize = offset;
+
+    std::vector<std::string> paths = {pLODPath};
+    if (!copyPath.empty())
+        paths.push_back(copyPath);
+
+    std::vector<std::unique_ptr<FILE, FileCloser>> files;
+    bool success = true;
+    for (const std::string &path : paths) {
+        files.emplace_back(fopen((path + ".tmp").c_str(), "wb"));
+        success &= files.back() != nullptr;
+    }
+
+    auto write = [&](const void *data, size_t size) {
+        for (const std::unique_ptr<FILE, FileCloser> &file : files)
+            success &= file && fwrite(data, 1, size, file.get()) == size;
+    };
+
+    write(&header, sizeof(LOD::FileHeader));
+    write(&Lindx, sizeof(LOD::Directory));
+    write(dirs.data(), sizeof(LOD::Directory) * dirs.size());
+    for (const Entry &entry : entries) {
+        if (!success)
+            break;
+
+        if (entry.data) {
+            write(entry.data->data(), entry.data->size());
+            continue;
+        }
+
+        fseek(pFile, uOffsetToSubIndex + entry.dir.uOfsetFromSubindicesStart, SEEK_SET);
+        size_t to_copy_size = entry.dir.uDataSize;
+        while (success && to_copy_size > 0) {
+            size_t read_size = std::min<size_t>(to_copy_size, uIOBufferSize);
+            success &= fread(pIOBuffer, read_size, 1, pFile) == 1;
+            write(pIOBuffer, read_size);
+            to_copy_size -= read_size;
+        }
+    }
+
+    for (std::unique_ptr<FILE, FileCloser> &file : files)
+        success &= file && fclose(file.release()) == 0;
+
+    std::error_code ec;
+    if (!success) {
+        for (const std::string &path : paths)
+            std::filesystem::remove(path + ".tmp", ec);
+        return false;
+    }
+
+    // Renaming over an existing file replaces it atomically, but the LOD has to be closed first on Windows.
+    CloseWriteFile();
+    for (const std::string &path : paths) {
+        std::filesystem::rename(path + ".tmp", path, ec);
+        success &= !ec;
+    }
+
+    return LoadFile(pLODPath, 0) && success;
+}
+
 LOD::WriteableFile::WriteableFile() {
     pIOBuffer = nullptr;
     uIOBufferSize = 0;
@@ -884,6 +1078,8 @@ void LODFile_IconsBitmaps::SetupPalettes(unsigned int uTargetRBits,
 }
 
 Blob LOD::File::LoadRaw(const std::string &pContainer) const {
+    MM_PROFILE_ZONE("LOD::File::LoadRaw");
+
     size_t size = 0;
     FILE *File = FindContainer(pContainer, &size);
     if (!File) {
@@ -895,6 +1091,15 @@ Blob LOD::File::LoadRaw(const std::string &pContainer) const {
 }
 
 Blob LOD::File::LoadCompressedTexture(const std::string &pContainer) {
+    MM_PROFILE_ZONE("LOD::File::LoadCompressedTexture");
+
+    std::string snapshotName;
+    if (pSnapshotReader || pSnapshotWriter)
+        snapshotName = toLower(pContainer); // LOD lookups are case-insensitive.
+
+    if (pSnapshotReader && pSnapshotReader->exists(snapshotName))
+        return pSnapshotReader->read(snapshotName);
+
     FILE *File = FindContainer(pContainer, 0);
     if (!File) {
         Error("Unable to load %s", pContainer.c_str());
@@ -905,14 +1110,26 @@ Blob LOD::File::LoadCompressedTexture(const std::string &pContainer) {
     if (fread(&DstBuf, sizeof(TextureHeader), 1, File) != 1)
         return Blob();
 
+    Blob result;
     if (DstBuf.uDecompressedSize) {
-        return zlib::Uncompress(Blob::read(File, DstBuf.uTextureSize), DstBuf.uDecompressedSize);
+        result = zlib::Uncompress(Blob::read(File, DstBuf.uTextureSize), DstBuf.uDecompressedSize);
     } else {
-        return Blob::read(File, DstBuf.uTextureSize);
+        result = Blob::read(File, DstBuf.uTextureSize);
     }
+
+    if (pSnapshotWriter)
+        pSnapshotWriter->add(snapshotName, result);
+    return result;
+}
+
+void LOD::File::SetSnapshot(std::shared_ptr<const SnapshotReader> reader, std::shared_ptr<SnapshotWriter> writer) {
+    pSnapshotReader = std::move(reader);
+    pSnapshotWriter = std::move(writer);
 }
 
 Blob LOD::File::LoadCompressed(const std::string &pContainer) {
+    MM_PROFILE_ZONE("LOD::File::LoadCompressed");
+
     FILE *File = FindContainer(pContainer, 0);
     if (!File) {
         Error("Unable to load %s", pContainer.c_str());
@@ -969,6 +1186,8 @@ int LODFile_IconsBitmaps::ReloadTexture(Texture_MM7 *pDst,
         return -1;
 
     strncpy(pDst->header.pName, pContainer.c_str(), 16);
+    if (pDst >= pTextures && pDst < pTextures + uNumLoadedFiles)
+        _indexLoadedTexture(pDst - pTextures);
     v8 = pDst->header.uTextureSize;
 
     if ((int)v8 <= (int)v7) {
@@ -1072,23 +1291,20 @@ Texture_MM7 *LODFile_IconsBitmaps::LoadTexturePtr(const std::string &pContainer,
 }
 
 unsigned int LODFile_IconsBitmaps::LoadTexture(const std::string &pContainer, TEXTURE_TYPE uTextureType) {
-    for (uint i = 0; i < uNumLoadedFiles; ++i) {
-        if (iequals(pContainer, pTextures[i].header.pName)) {
-            return i;
-        }
-    }
+    int index = _findLoadedTexture(pContainer);
+    if (index != -1)
+        return index;
 
     Assert(uNumLoadedFiles < 1000);
 
     if (LoadTextureFromLOD(&pTextures[uNumLoadedFiles], pContainer, uTextureType) == -1) {
-        for (uint i = 0; i < uNumLoadedFiles; ++i) {
-            if (iequals(pTextures[i].header.pName, "pending")) {
-                return i;
-            }
-        }
+        index = _findLoadedTexture("pending");
+        if (index != -1)
+            return index;
         LoadTextureFromLOD(&pTextures[uNumLoadedFiles], "pending", uTextureType);
     }
 
+    _indexLoadedTexture(uNumLoadedFiles);
     return uNumLoadedFiles++;
 }
 
@@ -1104,9 +1320,30 @@ Texture_MM7 *LODFile_IconsBitmaps::GetTexture(int idx) {
 bool Initialize_GamesLOD_NewLOD() {
     pGames_LOD = new LOD::File();
     if (pGames_LOD->Open(MakeDataPath("data", "games.lod"))) {
+        try {
+            gamesLodReader = LodReader::open(MakeDataPath("data", "games.lod"));
+        } catch (const Exception &e) {
+            logger->warning("Could not open games.lod for batched reads, falling back to sequential reads: {}", e.what());
+        }
+
         pSave_LOD = new LOD::WriteableFile;
         pSave_LOD->AllocSubIndicesAndIO(300, 100000);
         return true;
     }
     return false;
 }
+
+std::vector<Blob> LoadGamesLodFiles(const std::vector<std::string> &names) {
+    MM_PROFILE_ZONE("LoadGamesLodFiles");
+
+    if (!gamesLodReader) {
+        std::vector<Blob> result;
+        for (const std::string &name : names)
+            result.push_back(pGames_LOD->LoadCompressed(name));
+        return result;
+    }
+
+    if (!gamesLodPool)
+        gamesLodPool = std::make_unique<ThreadPool>();
+    return gamesLodReader->readMany(names, *gamesLodPool);
+}
@@ -1,11 +1,19 @@
 #pragma once
 
 #include <cstring>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "Engine/Graphics/Image.h"
 #include "Utility/Memory/Blob.h"
+#include "Utility/String.h"
+
+class SnapshotReader;
+class SnapshotWriter;
 
 class Sprite;
 
@@ -80,6 +88,16 @@ class File {
     Blob LoadCompressed(const std::string &pContainer);
     bool DoesContainerExist(const std::string &filename);
 
+    /**
+     * Attaches a startup snapshot to this LOD, see `SnapshotReader` & `SnapshotWriter`. Only
+     * `LoadCompressedTexture` goes through the snapshot.
+     *
+     * @param reader                    Snapshot to serve reads from, can be null. Files that are not in the
+     *                                  snapshot are read from the LOD as usual.
+     * @param writer                    Snapshot to record all LOD reads into, can be null.
+     */
+    void SetSnapshot(std::shared_ptr<const SnapshotReader> reader, std::shared_ptr<SnapshotWriter> writer);
+
     std::string GetSubNodeName(size_t index) const { return pSubIndices[index].pFilename; }
     size_t GetSubNodesCount() const { return uNumSubDirs; }
     int GetSubNodeIndex(const std::string &name) const;
@@ -104,6 +122,9 @@ class File {
 
     unsigned int uNumSubDirs;
     struct Directory *pSubIndices;
+
+    std::shared_ptr<const SnapshotReader> pSnapshotReader;
+    std::shared_ptr<SnapshotWriter> pSnapshotWriter;
 };
 
 class WriteableFile : public File {
@@ -112,6 +133,26 @@ class WriteableFile : public File {
     bool LoadFile(const std::string &filePath, bool bWriting);
     unsigned int Write(const std::string &file_name, const void *pDirData, size_t size, int a4);
     unsigned int Write(const std::string &file_name, const Blob &data);
+
+    /**
+     * Starts a write transaction. Until `CommitWrite` is called, `Write` calls don't touch the file and only buffer
+     * the entries in memory, so only replacing writes (`a4 == 0`) are supported.
+     */
+    void BeginWrite();
+
+    /**
+     * Writes out all the entries buffered since `BeginWrite`, in a single pass over the LOD. Entries are merged into
+     * the directory the same way `Write` would do it one by one.
+     *
+     * The resulting archive is written into temporary files that then replace the LOD and the copy with a rename, so
+     * on failure both are left untouched. The LOD is then reopened.
+     *
+     * @param copyPath                  If not empty, path to write a copy of the resulting archive to, e.g. a save
+     *                                  slot.
+     * @return                          Whether the write succeeded. Buffered entries are dropped either way.
+     */
+    bool CommitWrite(const std::string &copyPath = {});
+
     void CloseWriteFile();
     int CreateTempFile();
     bool FixDirectoryOffsets();
@@ -132,6 +173,8 @@ class WriteableFile : public File {
     unsigned int uIOBufferSize;
     FILE *pOutputFileHandle;
     unsigned int uLODDataSize;
+    bool isWriteInProgress = false;
+    std::vector<std::pair<std::string, Blob>> pPendingWrites;
 };
 };  // namespace LOD
 
@@ -176,6 +219,15 @@ class LODFile_IconsBitmaps : public LOD::File {
     int uTexturePacksCount;
     int pFacesLock;
     int _011BA4_debug_paletted_pixels_uncompressed;
+
+ private:
+    int _findLoadedTexture(std::string_view name);
+    void _indexLoadedTexture(int index);
+    void _trimTextureIndex();
+
+    // Texture name -> index in pTextures. Entries can go stale when textures are released, so every lookup is
+    // validated against the actual texture name & uNumLoadedFiles.
+    std::unordered_map<std::string, int, IHash, IEqual> _textureIndexByName;
 };
 
 #pragma pack(push, 1)
@@ -233,6 +285,13 @@ class LODFile_Sprites : public LOD::File {
     int field_ECA4;  // 2nd init sprites
     int field_ECA8;
     Sprite *pHardwareSprites;
+
+ private:
+    int _findLoadedSprite(std::string_view name);
+    void _trimSpriteIndex();
+
+    // Sprite name -> index in pHardwareSprites, validated on lookup just like in LODFile_IconsBitmaps.
+    std::unordered_map<std::string, int, IHash, IEqual> _spriteIndexByName;
 };
 
 extern LODFile_IconsBitmaps *pEvents_LOD;
@@ -251,3 +310,13 @@ extern LODFile_Sprites *pSprites_LOD_mm8;
 
 extern LOD::WriteableFile *pSave_LOD;
 extern LOD::File *pGames_LOD;
+
+/**
+ * Reads several files from games.lod at once, decompressing them in parallel on a worker pool. This is what map
+ * loading uses to get the level geometry & its initial delta in one go.
+ *
+ * @param names                         Names of the files to read, all must exist in games.lod.
+ * @return                              Decompressed contents of the requested files, in the same order as `names`.
+ * @throws Exception                    If any of the files couldn't be read.
+ */
+std::vector<Blob> LoadGamesLodFiles(const std::vector<std::string> &names);
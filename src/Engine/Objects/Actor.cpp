@@ -1,6 +1,7 @@
 #include "Engine/Objects/Actor.h"
 
 #include <algorithm>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,6 +13,7 @@
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Overlays.h"
 #include "Engine/Graphics/PaletteManager.h"
+#include "Engine/Graphics/SpatialGrid.h"
 #include "Engine/Graphics/Sprites.h"
 #include "Engine/Graphics/Vis.h"
 #include "Engine/Localization.h"
@@ -37,6 +39,8 @@
 #include "Media/Audio/AudioPlayer.h"
 
 #include "Utility/Math/TrigLut.h"
+#include "Utility/PartialSort.h"
+#include "Library/Profiler/Profiler.h"
 #include "Library/Random/Random.h"
 
 // should be injected into Actor but struct size cant be changed
@@ -2619,6 +2623,8 @@ void Actor::SummonMinion(int summonerId) {
 
 //----- (00401A91) --------------------------------------------------------
 void Actor::UpdateActorAI() {
+    MM_PROFILE_ZONE("Actor::UpdateActorAI");
+
     double v42;              // st7@176
     double v43;              // st6@176
     ABILITY_INDEX v45;                 // eax@192
@@ -4126,18 +4132,20 @@ void toggleActorGroupFlag(unsigned int uGroupID, ActorAttribute uFlag,
     }
 }
 
+static size_t maxFullAiActors() {
+    return engine->config->gameplay.FullAiActorLimit.value();
+}
+
 //----- (004014E6) --------------------------------------------------------
 void Actor::MakeActorAIList_ODM() {
-    int v1;           // eax@4
-    unsigned int v7;  // ST20_4@10
-    int distance;     // edi@10
-                      //  int v10; // ebx@14
-    int v21;          // [sp+Ch] [bp-14h]@4
-    int v22;          // [sp+10h] [bp-10h]@4
+    // Candidates are collected into reusable SoA arrays, only the nearest ones are then copied into ai_near_actors_*.
+    static std::vector<int> distances;
+    static std::vector<unsigned int> ids;
+    distances.clear();
+    ids.clear();
 
     pParty->uFlags &= 0xFFFFFFCF;  // ~0x30
 
-    ai_arrays_size = 0;
     for (uint i = 0; i < pActors.size(); ++i) {
         Actor *actor = &pActors[i];
 
@@ -4147,81 +4155,35 @@ void Actor::MakeActorAIList_ODM() {
             continue;
         }
 
-        v22 = abs(pParty->vPosition.z - actor->vPosition.z);
-        v21 = abs(pParty->vPosition.y - actor->vPosition.y);
-        v1 = abs(pParty->vPosition.x - actor->vPosition.x);
-        v7 = int_get_vector_length(v22, v21, v1);
-        distance = v7 - actor->uActorRadius;
+        int delta_z = abs(pParty->vPosition.z - actor->vPosition.z);
+        int delta_y = abs(pParty->vPosition.y - actor->vPosition.y);
+        int delta_x = abs(pParty->vPosition.x - actor->vPosition.x);
+        int distance = int_get_vector_length(delta_z, delta_y, delta_x) - actor->uActorRadius;
         if (distance < 0) distance = 0;
 
         if (distance < 5632) {
             actor->ResetHostile();
             if (actor->ActorEnemy() || actor->GetActorsRelation(0)) {
-                // v11 = (pParty->uFlags & 0x10) == 0;
                 actor->uAttributes |= ACTOR_HOSTILE;
                 if (distance < 5120) pParty->SetYellowAlert();
                 if (distance < 307) pParty->SetRedAlert();
             }
             actor->uAttributes |= ACTOR_ACTIVE;
-            ai_near_actors_distances[ai_arrays_size] = distance;
-            ai_near_actors_ids[ai_arrays_size++] = i;
+            distances.push_back(distance);
+            ids.push_back(i);
         } else {
             actor->ResetActive();
         }
     }
 
-    /*
-    result = v27;
-    if ( v27 > 0 )
-    {
-      v14 = 0;
-      v15 = 1;
-      v26 = 1;
-      do
-      {
-        while ( 1 )
-        {
-          v24 = v15;
-          if ( v15 >= result )
-            break;
-          v16 = ai_near_actors_distances[v14];
-          if ( v16 > ai_near_actors_distances[v15] )
-          {
-            v17 = &ai_near_actors_ids[v15];
-            v18 = ai_near_actors_ids[v14];
-            ai_near_actors_ids[v14] = *v17;
-            *v17 = v18;
-            v15 = v24;
-            ai_near_actors_distances[v14] = ai_near_actors_distances[v24];
-            ai_near_actors_distances[v24] = v16;
-          }
-          result = v27;
-          ++v15;
-        }
-        ++v14;
-        v15 = v26 + 1;
-        v26 = v15;
-      }
-      while ( v15 - 1 < result );
-    }*/
+    // Only the nearest actors get full ai. Ties are ordered the same way as the exchange sort that was used here
+    // before, which is not stable. This affects ai update order, and thus random number generation.
+    size_t size = std::min(ids.size(), maxFullAiActors());
+    legacyExchangeSortByKey(std::span(distances), std::span(ids), size);
 
-
-    // bubble sort nearest actors
-    for (int i = 0; i < ai_arrays_size; ++i) {
-        for (int j = 0; j < i; ++j) {
-            if (ai_near_actors_distances[j] > ai_near_actors_distances[i]) {
-                int tmp = ai_near_actors_distances[j];
-                ai_near_actors_distances[j] = ai_near_actors_distances[i];
-                ai_near_actors_distances[i] = tmp;
-
-                tmp = ai_near_actors_ids[j];
-                ai_near_actors_ids[j] = ai_near_actors_ids[i];
-                ai_near_actors_ids[i] = tmp;
-            }
-        }
-    }
-
-    if (ai_arrays_size > 30) ai_arrays_size = 30;
+    ai_arrays_size = size;
+    std::copy_n(distances.begin(), size, ai_near_actors_distances.begin());
+    std::copy_n(ids.begin(), size, ai_near_actors_ids.begin());
 
     for (int i = 0; i < ai_arrays_size; ++i)
         pActors[ai_near_actors_ids[i]].uAttributes |= ACTOR_FULL_AI_STATE;  // 0x400
@@ -4229,14 +4191,22 @@ void Actor::MakeActorAIList_ODM() {
 
 //----- (004016FA) --------------------------------------------------------
 int Actor::MakeActorAIList_BLV() {
-    //  __debugbreak(); // refactor for blv ai
+    static std::vector<int> distances;
+    static std::vector<unsigned int> ids;
+    static std::vector<int> actorDistances; // Indexed by actor id.
+    static std::vector<bool> actorListed; // Indexed by actor id, whether the actor is already in the ai list.
+    static std::vector<unsigned int> listIds;
+    distances.clear();
+    ids.clear();
+    actorDistances.assign(pActors.size(), 0);
+    actorListed.assign(pActors.size(), false);
+    listIds.clear();
 
     // reset party alert level
     pParty->uFlags &= ~PARTY_FLAGS_1_ALERT_RED_OR_YELLOW;  // ~0x30
     int party_sector = pBLVRenderParams->uPartySectorID;
 
     // find actors that are in range and can act
-    uint active_actor_count = 0;
     for (uint i = 0; i < pActors.size(); ++i) {
         pActors[i].ResetFullAiState();  // ~0x0400
 
@@ -4251,6 +4221,7 @@ int Actor::MakeActorAIList_BLV() {
 
         int distance = int_get_vector_length(delta_z, delta_y, delta_x) - pActors[i].uActorRadius;
         if (distance < 0) distance = 0;
+        actorDistances[i] = distance;
 
         // actor is in range
         if (distance < 10240) {
@@ -4262,90 +4233,54 @@ int Actor::MakeActorAIList_BLV() {
                 if (!(pParty->GetYellowAlert()) && distance < 5120)
                     pParty->SetYellowAlert();
             }
-            ai_near_actors_distances[active_actor_count] = distance;
-            ai_near_actors_ids[active_actor_count] = i;
-            active_actor_count++;
+            distances.push_back(distance);
+            ids.push_back(i);
         } else {
             // otherwise idle
             pActors[i].ResetActive();
         }
     }
 
-    // bubble sorting active actors by distance
-    if (active_actor_count > 0) {
-        for (uint i = 0; i < active_actor_count; i++) {
-            int change = 0;
-            for (uint j = 0; j < active_actor_count - i - 1; j++) {
-                if (ai_near_actors_distances[j] > ai_near_actors_distances[j + 1]) {
-                    std::swap(ai_near_actors_ids[j], ai_near_actors_ids[j + 1]);
-                    std::swap(ai_near_actors_distances[j], ai_near_actors_distances[j + 1]);
-                    change = 1;
-                }
-            }
-            // if no change the list is sorted
-            if (!change) break;
-        }
-    }
+    // All of the active actors are walked in distance order below, so this is a full sort. It's stable, and thus
+    // gives the same order as the bubble sort that was used here before.
+    stablePartialSortByKey(std::span(distances), std::span(ids), ids.size());
 
-    // checks nearby actors can detect player and takes nearest 30
-    int num_actors_detect_player = 0;
-    for (int i = 0; i < active_actor_count; i++) {
-        if (pActors[ai_near_actors_ids[i]].ActorNearby() ||
-            Detect_Between_Objects(
-                PID(OBJECT_Actor, ai_near_actors_ids[i]), PID(OBJECT_Player, 0))) {
-            pActors[ai_near_actors_ids[i]].uAttributes |= ACTOR_NEARBY;
-            ai_array_detected_actor_ids[num_actors_detect_player] = ai_near_actors_ids[i];
-            ai_array_detected_actor_dist[num_actors_detect_player++] = ai_near_actors_distances[i];
-            if (num_actors_detect_player >= 30) break;
+    size_t limit = maxFullAiActors();
+
+    // checks nearby actors can detect player and takes nearest ones
+    for (unsigned int id : ids) {
+        if (pActors[id].ActorNearby() || Detect_Between_Objects(PID(OBJECT_Actor, id), PID(OBJECT_Player, 0))) {
+            pActors[id].uAttributes |= ACTOR_NEARBY;
+            actorListed[id] = true;
+            listIds.push_back(id);
+            if (listIds.size() >= limit) break;
         }
     }
 
-    ai_arrays_size = num_actors_detect_player;
-
     // add any actors than can act and are in the same sector
-    for (uint i = 0; i < (signed int)pActors.size(); ++i) {
-        if (pActors[i].CanAct() && pActors[i].uSectorID == party_sector) {
-            int v25 = 0;
-            if (num_actors_detect_player <= 0) {
-                pActors[i].uAttributes |= ACTOR_ACTIVE;
-                ai_array_detected_actor_ids[ai_arrays_size++] = i;
-            } else {
-                // convoluted way of checking that this actor is not already on the list
-                while (ai_array_detected_actor_ids[v25] != i) {
-                    ++v25;
-                    if (v25 >= num_actors_detect_player) {
-                        pActors[i].uAttributes |= ACTOR_ACTIVE;
-                        ai_array_detected_actor_ids[ai_arrays_size++] = i;
-                        break;
-                    }
-                }
-            }
+    for (uint i = 0; i < pActors.size(); ++i) {
+        if (pActors[i].CanAct() && pActors[i].uSectorID == party_sector && !actorListed[i]) {
+            pActors[i].uAttributes |= ACTOR_ACTIVE;
+            actorListed[i] = true;
+            listIds.push_back(i);
         }
     }
 
     // add any actors that are active and have previosuly detected the player
-    for (int j = 0; j < active_actor_count; ++j) {
-        if (pActors[ai_near_actors_ids[j]].uAttributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[ai_near_actors_ids[j]].CanAct()) {
-            int v30 = 0;
-            if (ai_arrays_size <= 0) {
-                ai_array_detected_actor_ids[ai_arrays_size++] = ai_near_actors_ids[j];
-            } else {
-                // convoluted way of checking that this actor is not already on the list
-                while (ai_array_detected_actor_ids[v30] != ai_near_actors_ids[j]) {
-                    ++v30;
-                    if (v30 >= ai_arrays_size) {
-                        ai_array_detected_actor_ids[ai_arrays_size++] = ai_near_actors_ids[j];
-                        break;
-                    }
-                }
-            }
+    for (unsigned int id : ids) {
+        if (pActors[id].uAttributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[id].CanAct() && !actorListed[id]) {
+            actorListed[id] = true;
+            listIds.push_back(id);
         }
     }
 
-    // take the first 30 from list
-    if (ai_arrays_size > 30) ai_arrays_size = 30;
-    memcpy(ai_near_actors_ids.data(), ai_array_detected_actor_ids.data(), 4 * ai_arrays_size);
-    memcpy(ai_near_actors_distances.data(), ai_array_detected_actor_dist.data(), 4 * ai_arrays_size);
+    // take the nearest ones from list. Vanilla copied stale distances for the actors that were added by the last two
+    // loops, here all distances are current. ai_near_actors_distances is never read, so this doesn't affect gameplay.
+    ai_arrays_size = std::min(listIds.size(), limit);
+    for (int i = 0; i < ai_arrays_size; i++) {
+        ai_near_actors_ids[i] = listIds[i];
+        ai_near_actors_distances[i] = actorDistances[listIds[i]];
+    }
 
     // activate ai state for these actors
     for (int i = 0; i < ai_arrays_size; i++)
@@ -4967,7 +4902,10 @@ void evaluateAoeDamage() {
                 }
             }
 
-            for (int actorID = 0; actorID < pActors.size(); ++actorID) {
+            // Damaging an actor never moves the other ones, so it's OK to look them up once.
+            std::vector<int> nearActors;
+            FindActorsNear(BBoxf::fromPoint(attack.pos.toFloat(), std::max(attack.attackRange, 0)), 0, &nearActors);
+            for (int actorID : nearActors) {
                 if (pActors[actorID].CanAct()) {
                     Vec3i distanceVec = pActors[actorID].vPosition + Vec3i(0, 0, pActors[actorID].uActorHeight / 2) - attack.pos;
                     int distanceSq = distanceVec.lengthSqr();
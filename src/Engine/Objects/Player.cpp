@@ -2409,7 +2409,52 @@ int Player::GetSpecialItemBonus(ITEM_ENCHANTMENT enchantment) const {
 }
 
 //----- (0048EAAE) --------------------------------------------------------
+void PlayerItemsBonusCache::validate(const Player &player) {
+    std::array<int, KEY_SIZE> key;
+    auto pos = key.begin();
+    for (ITEM_SLOT slot : AllItemSlots()) {
+        unsigned int index = player.pEquipment.pIndices[slot];
+        const ItemGen *item = index ? &player.pOwnItems[index - 1] : nullptr;
+        *pos++ = index;
+        *pos++ = item ? std::to_underlying(item->uItemID) : 0;
+        *pos++ = item ? item->uEnchantmentType : 0;
+        *pos++ = item ? item->m_enchantmentStrength : 0;
+        *pos++ = item ? std::to_underlying(item->special_enchantment) : 0;
+        *pos++ = item ? item->IsBroken() : 0;
+    }
+    for (PLAYER_SKILL skill : player.pActiveSkills)
+        *pos++ = skill;
+    assert(pos == key.end());
+
+    if (_hasKey && key == _key)
+        return;
+
+    _key = key;
+    _hasKey = true;
+    _valid.reset();
+}
+
 int Player::GetItemsBonus(CHARACTER_ATTRIBUTE_TYPE attr, bool getOnlyMainHandDmg /*= false*/) const {
+    if (!PlayerItemsBonusCache::isCacheable(attr))
+        return CalculateItemsBonus(attr, getOnlyMainHandDmg);
+
+    itemsBonusCache.validate(*this);
+    if (itemsBonusCache.contains(attr, getOnlyMainHandDmg)) {
+        int result = itemsBonusCache.get(attr, getOnlyMainHandDmg);
+        if (engine->config->debug.VerifyItemsBonusCache.value()) {
+            int expected = CalculateItemsBonus(attr, getOnlyMainHandDmg);
+            if (result != expected)
+                Error("Items bonus cache mismatch for attribute %d: cached %d, expected %d", attr, result, expected);
+        }
+        return result;
+    }
+
+    int result = CalculateItemsBonus(attr, getOnlyMainHandDmg);
+    itemsBonusCache.set(attr, getOnlyMainHandDmg, result);
+    return result;
+}
+
+int Player::CalculateItemsBonus(CHARACTER_ATTRIBUTE_TYPE attr, bool getOnlyMainHandDmg) const {
     int v5;                     // edi@1
     int v14;                    // ecx@58
     int v15;                    // eax@58
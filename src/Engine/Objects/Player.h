@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <bitset>
 #include <vector>
 #include <string>
 #include <utility>
@@ -151,6 +153,57 @@ class PlayerConditions {
     std::array<GameTime, 20> times_;
 };
 
+struct Player;
+
+/**
+ * Cache for `Player::GetItemsBonus`, which walks all equipped items & their enchantments on every call.
+ *
+ * Equipment & inventory are modified directly all over the engine, so instead of relying on explicit invalidation,
+ * the cache stores a snapshot of everything item bonuses depend on (equipped items and skills), and drops all cached
+ * values when the snapshot changes. Comparing snapshots is a lot cheaper than recomputing the bonuses.
+ */
+class PlayerItemsBonusCache {
+ public:
+    /**
+     * Drops cached values if `player` was changed since the last call.
+     */
+    void validate(const Player &player);
+
+    [[nodiscard]] bool contains(CHARACTER_ATTRIBUTE_TYPE attr, bool getOnlyMainHandDmg) const {
+        return _valid[index(attr, getOnlyMainHandDmg)];
+    }
+
+    [[nodiscard]] int get(CHARACTER_ATTRIBUTE_TYPE attr, bool getOnlyMainHandDmg) const {
+        assert(contains(attr, getOnlyMainHandDmg));
+        return _values[index(attr, getOnlyMainHandDmg)];
+    }
+
+    void set(CHARACTER_ATTRIBUTE_TYPE attr, bool getOnlyMainHandDmg, int value) {
+        _valid[index(attr, getOnlyMainHandDmg)] = true;
+        _values[index(attr, getOnlyMainHandDmg)] = value;
+    }
+
+    [[nodiscard]] static bool isCacheable(CHARACTER_ATTRIBUTE_TYPE attr) {
+        return attr >= 0 && attr < ATTRIBUTE_COUNT;
+    }
+
+ private:
+    static constexpr int ATTRIBUTE_COUNT = CHARACTER_ATTRIBUTE_SKILL_LEARNING + 1;
+    static constexpr int SLOT_KEY_SIZE = 6;
+    static constexpr int KEY_SIZE =
+        SLOT_KEY_SIZE * (std::to_underlying(ITEM_SLOT_LAST_VALID) - std::to_underlying(ITEM_SLOT_FIRST_VALID) + 1) +
+        (std::to_underlying(PLAYER_SKILL_LAST) - std::to_underlying(PLAYER_SKILL_FIRST) + 1);
+
+    static int index(CHARACTER_ATTRIBUTE_TYPE attr, bool getOnlyMainHandDmg) {
+        return attr * 2 + getOnlyMainHandDmg;
+    }
+
+    std::array<int, KEY_SIZE> _key = {{}};
+    bool _hasKey = false;
+    std::bitset<ATTRIBUTE_COUNT * 2> _valid;
+    std::array<int, ATTRIBUTE_COUNT * 2> _values = {{}};
+};
+
 // TODO(eksekk): Rename to "Character" (incl. all methods and helper functions, and probably enums too)
 struct Player {
     static constexpr unsigned int INVENTORY_SLOTS_WIDTH = 14;
@@ -249,7 +302,14 @@ struct Player {
     Condition GetMajorConditionIdx() const;
     int GetParameterBonus(int player_parameter) const;
     int GetSpecialItemBonus(ITEM_ENCHANTMENT enchantment) const;
+    /**
+     * @param attr                      Attribute to get item bonus for.
+     * @param getOnlyMainHandDmg        Whether only main hand weapon should be taken into account for melee damage.
+     * @return                          Total bonus from equipped items. Results are cached, see
+     *                                  `PlayerItemsBonusCache`.
+     */
     int GetItemsBonus(CHARACTER_ATTRIBUTE_TYPE attr, bool getOnlyMainHandDmg = false) const;
+    int CalculateItemsBonus(CHARACTER_ATTRIBUTE_TYPE attr, bool getOnlyMainHandDmg = false) const;
     int GetMagicalBonus(CHARACTER_ATTRIBUTE_TYPE a2) const;
     PLAYER_SKILL_LEVEL GetActualSkillLevel(PLAYER_SKILL_TYPE uSkillType) const;
     PLAYER_SKILL_MASTERY GetActualSkillMastery(PLAYER_SKILL_TYPE uSkillType) const;
@@ -612,6 +672,8 @@ struct Player {
     char uNumArmageddonCasts;
     char uNumFireSpikeCasts;
     char field_1B3B_set0_unused;
+
+    mutable PlayerItemsBonusCache itemsBonusCache;
 };
 
 inline CHARACTER_EXPRESSION_ID expressionForCondition(Condition condition) {
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/SpellFxRenderer.h"
@@ -26,10 +27,12 @@
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/ParticleEngine.h"
 #include "Engine/Graphics/Sprites.h"
+#include "Engine/Graphics/SpatialGrid.h"
 
 #include "Media/Audio/AudioPlayer.h"
 
 #include "Utility/Math/TrigLut.h"
+#include "Library/Profiler/Profiler.h"
 #include "Library/Random/Random.h"
 
 // should be injected in SpriteObject but struct size cant be changed
@@ -101,9 +104,21 @@ int SpriteObject::Create(int yaw, int pitch, int speed, int which_char) {
         pSpriteObjects.resize(sprite_slot + 1);
     }
     pSpriteObjects[sprite_slot] = *this;
+    UpdateSpriteObjectInSpatialGrid(sprite_slot);
     return sprite_slot;
 }
 
+static int maxMonsterToHitRadius() {
+    // Monster list is loaded once on startup, so it's OK to cache this.
+    static int result = [] {
+        int radius = 0;
+        for (const MonsterDesc &desc : pMonsterList->pMonsters)
+            radius = std::max(radius, static_cast<int>(desc.uToHitRadius));
+        return radius;
+    }();
+    return result;
+}
+
 static void createSpriteTrailParticle(Vec3i pos, OBJECT_DESC_FLAGS flags) {
     Particle_sw particle;
     memset(&particle, 0, sizeof(Particle_sw));
@@ -232,18 +247,20 @@ void SpriteObject::updateObjectODM(unsigned int uLayingItemID) {
         if (casterType != OBJECT_Player) {
             CollideWithParty(false);
         }
+        static std::vector<int> nearActors;
+        FindActorsNear(collision_state.bbox, 0, &nearActors);
         if (casterType == OBJECT_Actor) {
             int actorId = PID_ID(pSpriteObjects[uLayingItemID].spell_caster_pid);
             // TODO: why pActors.size() - 1? Should just check for .size()
             if ((actorId >= 0) && (actorId < (pActors.size() - 1))) {
-                for (int j = 0; j < pActors.size(); ++j) {
+                for (int j : nearActors) {
                     if (pActors[actorId].GetActorsRelation(&pActors[j])) {
                         CollideWithActor(j, 0);
                     }
                 }
             }
         } else {
-            for (int j = 0; j < pActors.size(); ++j) {
+            for (int j : nearActors) {
                 CollideWithActor(j, 0);
             }
         }
@@ -379,6 +396,9 @@ LABEL_25:
                 return;
             }
 
+            static std::vector<int> nearActors;
+            FindActorsNear(collision_state.bbox, std::max(maxMonsterToHitRadius(), actorGrid.maxRadius()), &nearActors);
+
             // TODO(Nik-RE-dev): check purpose of inner loop
             for (int loop2 = 0; loop2 < 100; ++loop2) {
                 CollideIndoorWithGeometry(false);
@@ -388,7 +408,7 @@ LABEL_25:
                     CollideWithParty(true);
                 }
 
-                for (int actloop = 0; actloop < (signed int)pActors.size(); ++actloop) {
+                for (int actloop : nearActors) {
                     // dont collide against self monster type
                     if (PID_TYPE(pSpriteObject->spell_caster_pid) == OBJECT_Actor) {
                         if (pActors[PID_ID(pSpriteObject->spell_caster_pid)].pMonsterInfo.uID == pActors[actloop].pMonsterInfo.uID) {
@@ -1292,6 +1312,8 @@ void applySpellSpriteDamage(unsigned int uLayingItemID, int pid) {
 }
 
 void UpdateObjects() {
+    MM_PROFILE_ZONE("UpdateObjects");
+
     for (uint i = 0; i < pSpriteObjects.size(); ++i) {
         if (pSpriteObjects[i].uAttributes & SPRITE_SKIP_A_FRAME) {
             pSpriteObjects[i].uAttributes &= ~SPRITE_SKIP_A_FRAME;
@@ -1359,6 +1381,10 @@ void UpdateObjects() {
             }
         }
     }
+
+    // Party & actors are moved next, and they need to see where the sprite objects are now.
+    for (int i = 0; i < pSpriteObjects.size(); ++i)
+        UpdateSpriteObjectInSpatialGrid(i);
 }
 
 unsigned int collideWithActor(unsigned int uLayingItemID, signed int pid) {
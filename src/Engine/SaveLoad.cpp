@@ -1,9 +1,16 @@
 #include "Engine/SaveLoad.h"
 
 #include <cstdlib>
+#include <chrono>
+#include <exception>
 #include <filesystem>
 #include <algorithm>
+#include <functional>
+#include <future>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Library/Compression/Compression.h"
 
@@ -32,9 +39,13 @@
 
 #include "Media/Audio/AudioPlayer.h"
 
+#include "Utility/ThreadPool.h"
+
 struct SavegameList *pSavegameList = new SavegameList;
 
 void LoadGame(unsigned int uSlot) {
+    WaitForPendingSave();
+
     if (!pSavegameList->pSavegameUsedSlots[uSlot]) {
         pAudioPlayer->playUISound(SOUND_error);
         logger->warning("LoadGame: slot {} is empty", uSlot);
@@ -144,11 +155,37 @@ void LoadGame(unsigned int uSlot) {
     bFlashHistoryBook = false;
 }
 
-void SaveGame(bool IsAutoSAve, bool NotSaveWorld) {
-    s_SavedMapName = pCurrentMapName;
-    if (pCurrentMapName == "d05.blv") {  // arena
-        return;
-    }
+static constexpr int SAVE_SCREENSHOT_WIDTH = 150;
+static constexpr int SAVE_SCREENSHOT_HEIGHT = 112;
+
+struct BeaconSnapshot {
+    std::string name; // LOD entry name, e.g. "lloyd11.pcx".
+    Blob pixels; // Raw A8B8G8R8 pixels.
+    size_t width = 0;
+    size_t height = 0;
+};
+
+/**
+ * Game state captured for a save. Capturing is fast and happens on the game thread, while all the encoding,
+ * compression and disk IO is done later in `WriteSaveSnapshot`, possibly on a worker thread.
+ */
+struct SaveSnapshot {
+    Blob screenshot; // Raw A8B8G8R8 pixels, SAVE_SCREENSHOT_WIDTH x SAVE_SCREENSHOT_HEIGHT.
+    SaveGame_MM7 save;
+    std::vector<BeaconSnapshot> beacons;
+    std::string deltaName; // Empty if the world is not saved.
+    std::unique_ptr<IndoorDelta_MM7> indoorDelta;
+    std::unique_ptr<OutdoorDelta_MM7> outdoorDelta;
+    std::vector<std::pair<std::string, Blob>> extraEntries; // Written after everything else.
+    std::string copyPath; // Where to write a copy of the resulting LOD, e.g. a save slot. Can be empty.
+};
+
+static std::unique_ptr<ThreadPool> saveThread; // Created lazily, on first async save.
+static std::future<bool> pendingSave;
+static std::function<void(bool)> pendingSaveCallback;
+
+static SaveSnapshot MakeSaveSnapshot(bool NotSaveWorld) {
+    SaveSnapshot result;
 
     int pPositionX = pParty->vPosition.x;
     int pPositionY = pParty->vPosition.y;
@@ -179,18 +216,13 @@ void SaveGame(bool IsAutoSAve, bool NotSaveWorld) {
     //    render->Present();
     //}
 
-    Blob packedScreenshot{ render->PackScreenshot(150, 112) };  // создание скриншота
-    if (pSave_LOD->Write("image.pcx", packedScreenshot.data(), packedScreenshot.size(), 0)) {
-        logger->warning("{}", localization->FormatString(LSTR_FMT_SAVEGAME_CORRUPTED, 200));
-    }
+    uint32_t *screenshot = render->MakeScreenshot32(SAVE_SCREENSHOT_WIDTH, SAVE_SCREENSHOT_HEIGHT);  // создание скриншота
+    result.screenshot = Blob::fromMalloc(screenshot, SAVE_SCREENSHOT_WIDTH * SAVE_SCREENSHOT_HEIGHT * sizeof(uint32_t));
 
     SaveGameHeader save_header;
     save_header.locationName = pCurrentMapName;
     save_header.playingTime = pParty->GetPlayingTime();
-
-    SaveGame_MM7 save;
-    serialize(save_header, &save);
-    serialize(save, pSave_LOD);
+    serialize(save_header, &result.save);
 
     // TODO(captainurist): incapsulate this too
     for (size_t i = 0; i < 4; ++i) {  // 4 - players
@@ -206,28 +238,57 @@ void SaveGame(bool IsAutoSAve, bool NotSaveWorld) {
                 if (!pixels)
                     __debugbreak();
 
-                Blob packedPCX{ PCX::Encode(pixels, image->GetWidth(), image->GetHeight()) };
-                std::string str = fmt::format("lloyd{}{}.pcx", i + 1, j + 1);
-                if (pSave_LOD->Write(str, packedPCX.data(), packedPCX.size(), 0)) {
-                    logger->warning("{}", localization->FormatString(LSTR_FMT_SAVEGAME_CORRUPTED, 207));
-                }
+                BeaconSnapshot &snapshot = result.beacons.emplace_back();
+                snapshot.name = fmt::format("lloyd{}{}.pcx", i + 1, j + 1);
+                snapshot.width = image->GetWidth();
+                snapshot.height = image->GetHeight();
+                snapshot.pixels = Blob::copy(pixels, snapshot.width * snapshot.height * sizeof(uint32_t));
             }
         }
     }
 
-    Blob uncompressed;
     if (!NotSaveWorld) {  // autosave for change location
         CompactLayingItemsList();
 
         if (uCurrentlyLoadedLevelType == LEVEL_Indoor) {
-            IndoorDelta_MM7 delta;
-            serialize(*pIndoor, &delta);
-            serialize(delta, &uncompressed);
+            result.indoorDelta = std::make_unique<IndoorDelta_MM7>();
+            serialize(*pIndoor, result.indoorDelta.get());
         } else {
             assert(uCurrentlyLoadedLevelType == LEVEL_Outdoor);
-            OutdoorDelta_MM7 delta;
-            serialize(*pOutdoor, &delta);
-            serialize(delta, &uncompressed);
+            result.outdoorDelta = std::make_unique<OutdoorDelta_MM7>();
+            serialize(*pOutdoor, result.outdoorDelta.get());
+        }
+
+        result.deltaName = pCurrentMapName;
+        size_t pos = result.deltaName.find_last_of(".");
+        result.deltaName[pos + 1] = 'd';
+    }
+
+    pParty->vPosition.x = pPositionX;
+    pParty->vPosition.y = pPositionY;
+    pParty->vPosition.z = pPositionZ;
+    pParty->uFallStartZ = pPositionZ;
+    pParty->_viewYaw = partyViewYaw;
+    pParty->_viewPitch = partyViewPitch;
+    return result;
+}
+
+// Doesn't touch any game state, so it's safe to call on a worker thread as long as nothing else is using pSave_LOD.
+static bool WriteSaveSnapshot(const SaveSnapshot &snapshot) {
+    pSave_LOD->BeginWrite();
+    pSave_LOD->Write("image.pcx", PCX::Encode(snapshot.screenshot.data(), SAVE_SCREENSHOT_WIDTH, SAVE_SCREENSHOT_HEIGHT));
+
+    serialize(snapshot.save, pSave_LOD);
+
+    for (const BeaconSnapshot &beacon : snapshot.beacons)
+        pSave_LOD->Write(beacon.name, PCX::Encode(beacon.pixels.data(), beacon.width, beacon.height));
+
+    if (!snapshot.deltaName.empty()) {
+        Blob uncompressed;
+        if (snapshot.indoorDelta) {
+            serialize(*snapshot.indoorDelta, &uncompressed);
+        } else {
+            serialize(*snapshot.outdoorDelta, &uncompressed);
         }
 
         LOD::CompressedHeader odm_data;
@@ -242,48 +303,83 @@ void SaveGame(bool IsAutoSAve, bool NotSaveWorld) {
         odm_data.uCompressedSize = compressed.size();
         odm_data.uDecompressedSize = uncompressed.size();
 
-        Blob mapBlob = Blob::concat(Blob::view(&odm_data, sizeof(odm_data)), compressed);
+        pSave_LOD->Write(snapshot.deltaName, Blob::concat(Blob::view(&odm_data, sizeof(odm_data)), compressed));
+    }
+
+    for (const auto &[name, data] : snapshot.extraEntries)
+        pSave_LOD->Write(name, data);
 
-        std::string file_name = pCurrentMapName;
-        size_t pos = file_name.find_last_of(".");
-        file_name[pos + 1] = 'd';
-        if (pSave_LOD->Write(file_name, mapBlob.data(), mapBlob.size(), 0)) {
-            logger->warning("{}", localization->FormatString(LSTR_FMT_SAVEGAME_CORRUPTED, 208));
-        }
+    return pSave_LOD->CommitWrite(snapshot.copyPath);
+}
+
+// Writes out the snapshot, on the save thread if async saving is enabled. Callback is always invoked on the game thread.
+static void RunSave(SaveSnapshot snapshot, std::function<void(bool)> callback) {
+    WaitForPendingSave(); // Overlapping saves would both write into pSave_LOD.
+
+    if (!engine->config->settings.AsyncSaving.value()) {
+        callback(WriteSaveSnapshot(snapshot));
+        return;
     }
 
-    if (IsAutoSAve) {
-        std::string src = MakeDataPath("data", "new.lod");
-        std::string dst = MakeDataPath("saves", "autosave.mm7");
-        std::error_code ec;
-        if (!std::filesystem::copy_file(src, dst, std::filesystem::copy_options::overwrite_existing, ec))
-            logger->warning("Copying of autosave.mm7 failed");
+    if (!saveThread)
+        saveThread = std::make_unique<ThreadPool>(1);
+    pendingSave = saveThread->run([snapshot = std::move(snapshot)] { return WriteSaveSnapshot(snapshot); });
+    pendingSaveCallback = std::move(callback);
+}
+
+void WaitForPendingSave() {
+    if (!pendingSave.valid())
+        return;
+
+    // Don't let an exception from the save thread escape into the game loop, report it as a failed save instead.
+    bool success = false;
+    try {
+        success = pendingSave.get();
+    } catch (const std::exception &e) {
+        logger->warning("Failed to write the save: {}", e.what());
     }
-    pParty->vPosition.x = pPositionX;
-    pParty->vPosition.y = pPositionY;
-    pParty->vPosition.z = pPositionZ;
-    pParty->uFallStartZ = pPositionZ;
-    pParty->_viewYaw = partyViewYaw;
-    pParty->_viewPitch = partyViewPitch;
+
+    std::function<void(bool)> callback = std::move(pendingSaveCallback);
+    pendingSaveCallback = nullptr;
+    callback(success);
+}
+
+void PollPendingSave() {
+    if (pendingSave.valid() && pendingSave.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        WaitForPendingSave();
+}
+
+void SaveGame(bool IsAutoSAve, bool NotSaveWorld) {
+    s_SavedMapName = pCurrentMapName;
+    if (pCurrentMapName == "d05.blv") {  // arena
+        return;
+    }
+
+    SaveSnapshot snapshot = MakeSaveSnapshot(NotSaveWorld);
+    if (IsAutoSAve)
+        snapshot.copyPath = MakeDataPath("saves", "autosave.mm7");
+
+    RunSave(std::move(snapshot), [](bool success) {
+        if (!success)
+            logger->warning("{}", localization->FormatString(LSTR_FMT_SAVEGAME_CORRUPTED, 200));
+    });
 }
 
 void DoSavegame(unsigned int uSlot) {
+    SaveSnapshot snapshot;
     if (pCurrentMapName != "d05.blv") {  // Not Arena(не Арена)
-        SaveGame(0, 0);
+        s_SavedMapName = pCurrentMapName;
+        snapshot = MakeSaveSnapshot(false);
         pSavegameList->pSavegameHeader[uSlot].locationName = pCurrentMapName;
         pSavegameList->pSavegameHeader[uSlot].playingTime = pParty->GetPlayingTime();
 
         // TODO(captainurist): ooof
         SaveGameHeader_MM7 headerMm7;
         serialize(pSavegameList->pSavegameHeader[uSlot], &headerMm7);
+        snapshot.extraEntries.emplace_back("header.bin", Blob::copy(&headerMm7, sizeof(headerMm7)));
 
-        pSave_LOD->Write("header.bin", &headerMm7, sizeof(headerMm7), 0);
-        pSave_LOD->CloseWriteFile();  //закрыть
-        std::string src = MakeDataPath("data", "new.lod");
-        std::string dst = MakeDataPath("saves", fmt::format("save{:03}.mm7", uSlot));
-        std::error_code ec;
-        if (!std::filesystem::copy_file(src, dst, std::filesystem::copy_options::overwrite_existing, ec))
-            Error("Failed to copy: %s", src.c_str());
+        // Written straight into the slot, together with new.lod, so there's no need to copy the whole file afterwards.
+        snapshot.copyPath = MakeDataPath("saves", fmt::format("save{:03}.mm7", uSlot));
     }
     pSavegameList->selectedSlot = uSlot;
 
@@ -298,13 +394,21 @@ void DoSavegame(unsigned int uSlot) {
         }
     }
 
-    if (pCurrentMapName != "d05.blv")
-        pSave_LOD->_4621A7();
-    else
+    pEventTimer->Resume();
+
+    if (pCurrentMapName == "d05.blv") {
         GameUI_SetStatusBar(LSTR_NO_SAVING_IN_ARENA);
+        return;
+    }
 
-    pEventTimer->Resume();
-    GameUI_SetStatusBar(LSTR_GAME_SAVED);
+    std::string path = snapshot.copyPath;
+    RunSave(std::move(snapshot), [path](bool success) {
+        if (!success) {
+            Error("Failed to save: %s", path.c_str());
+            return;
+        }
+        GameUI_SetStatusBar(LSTR_GAME_SAVED);
+    });
 }
 
 void SavegameList::Initialize() {
@@ -341,6 +445,8 @@ void SavegameList::Reset() {
 }
 
 void SaveNewGame() {
+    WaitForPendingSave();
+
     if (pSave_LOD != nullptr) {
         pSave_LOD->CloseWriteFile();
     }
@@ -31,8 +31,34 @@ struct SavegameList {
 };
 
 void LoadGame(unsigned int uSlot);
+
+/**
+ * Saves the game into `new.lod`. Game state is captured right away, but if async saving is enabled in the config,
+ * the save is written out on a background thread.
+ *
+ * @param IsAutoSAve                    Whether to also write the save into `autosave.mm7`.
+ * @param NotSaveWorld                  Whether to skip saving the current location's state.
+ */
 void SaveGame(bool IsAutoSAve, bool NotSaveWorld);
+
+/**
+ * Saves the game into the provided slot, see `SaveGame`. The "game saved" status bar message is shown once the save
+ * is written out.
+ */
 void DoSavegame(unsigned int uSlot);
+
+/**
+ * Waits for the save that's being written in the background to finish, if any. Must be called before accessing
+ * `pSave_LOD`. Exceptions thrown while writing the save are not propagated, the save is reported as failed instead.
+ */
+void WaitForPendingSave();
+
+/**
+ * Finishes the background save if it's done writing, without blocking. Should be called once a frame on the game
+ * thread.
+ */
+void PollPendingSave();
+
 bool Initialize_GamesLOD_NewLOD();
 void SaveNewGame();
 
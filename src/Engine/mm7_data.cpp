@@ -2438,8 +2438,6 @@ std::array<unsigned short, 6> pMaxLevelPerTrainingHallType = {{5, 15, 25, 25, 20
 std::array<int, 11> price_for_membership = {{100, 100, 50, 50, 50, 50, 50, 50, 50, 1000, 1000}};
 
 int ai_arrays_size;
-std::array<int, 500> ai_array_detected_actor_dist;
-std::array<int, 500> ai_array_detected_actor_ids;
 std::array<int, 500> ai_near_actors_targets_pid;
 std::array<int, 500> ai_near_actors_distances;
 std::array<unsigned int, 500> ai_near_actors_ids;
@@ -258,6 +258,8 @@ enum UIMessageType : uint32_t {
     UIMSG_OpenDebugMenu = 999,
     UIMSG_DebugReloadShader = 1000,
     UIMSG_DebugUnused = 1001,
+    UIMSG_DebugProfiler = 1002,
+    UIMSG_DebugProfilerDump = 1003,
 };
 
 /*  251 */
@@ -2029,8 +2029,8 @@ GUIWindow_DebugMenu::GUIWindow_DebugMenu()
     GUIButton *pBtn_DebugSpecialItem = CreateButton({354, 275}, {width, height}, 1, 0, UIMSG_DebugSpecialItem, 0, InputAction::Invalid, "DEBUG GENERATE RANDOM SPECIAL ITEM");
 
     GUIButton *pBtn_DebugReloadShaders = CreateButton({13, 302}, {width, height}, 1, 0, UIMSG_DebugReloadShader, 0, InputAction::ReloadShaders, "DEBUG RELOAD SHADERS");
-    GUIButton *pBtn_DebugUnused1 = CreateButton({127, 302}, {width, height}, 1, 0, UIMSG_DebugUnused, 0, InputAction::Invalid, "DEBUG unused1");
-    GUIButton *pBtn_DebugUnused2 = CreateButton({241, 302}, {width, height}, 1, 0, UIMSG_DebugUnused, 0, InputAction::Invalid, "DEBUG unused2");
+    GUIButton *pBtn_DebugProfiler = CreateButton({127, 302}, {width, height}, 1, 0, UIMSG_DebugProfiler, 0, InputAction::Invalid, "DEBUG TOGGLE PROFILER");
+    GUIButton *pBtn_DebugProfilerDump = CreateButton({241, 302}, {width, height}, 1, 0, UIMSG_DebugProfilerDump, 0, InputAction::Invalid, "DEBUG DUMP PROFILER ZONES");
     GUIButton *pBtn_DebugUnused3 = CreateButton({354, 302}, {width, height}, 1, 0, UIMSG_DebugUnused, 0, InputAction::Invalid, "DEBUG unused3");
 
     GUIButton *pBtn_DebugKillChar = CreateButton({13, 329}, {width, height}, 1, 0, UIMSG_DebugKillChar, 0, InputAction::Invalid, "DEBUG KILL SELECTED CHARACTER");
@@ -2088,8 +2088,8 @@ void GUIWindow_DebugMenu::Update() {
     buttonbox(354, 275, "Special Item", 2);
 
     buttonbox(13, 302, "HOT Shaders", 2);
-    buttonbox(127, 302, "Unused1", 2);
-    buttonbox(241, 302, "Unused2", 2);
+    buttonbox(127, 302, "Profiler", engine->config->debug.Profiler.value());
+    buttonbox(241, 302, "Dump Profile", 2);
     buttonbox(354, 302, "Unused3", 2);
 
     // times ??
@@ -1,6 +1,7 @@
 #include "PlatformApplication.h"
 
 #include <cassert>
+#include <utility>
 
 #include "Utility/MapAccess.h"
 
@@ -64,10 +65,14 @@ static void initProxyLeaf(ProxyBase<T> *root, T *leaf) {
     root->setBase(leaf);
 }
 
-PlatformApplication::PlatformApplication(PlatformLogger *logger) : _logger(logger) {
+PlatformApplication::PlatformApplication(PlatformLogger *logger) :
+    PlatformApplication(logger, Platform::createStandardPlatform(logger)) {}
+
+PlatformApplication::PlatformApplication(PlatformLogger *logger, std::unique_ptr<Platform> platform) :
+    _logger(logger), _platform(std::move(platform)) {
     assert(logger);
+    assert(_platform);
 
-    _platform = Platform::createStandardPlatform(logger);
     _eventLoop = _platform->createEventLoop();
     _window = _platform->createWindow();
     _eventHandler = std::make_unique<FilteringEventHandler>();
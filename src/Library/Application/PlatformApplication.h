@@ -35,6 +35,12 @@ class ApplicationProxy;
 class PlatformApplication {
  public:
     explicit PlatformApplication(PlatformLogger *logger);
+
+    /**
+     * @param logger                    Logger to use.
+     * @param platform                  Platform to run on, e.g. a `NullPlatform` to run without a display.
+     */
+    PlatformApplication(PlatformLogger *logger, std::unique_ptr<Platform> platform);
     ~PlatformApplication();
 
     void initializeOpenGLContext(const PlatformOpenGLOptions &options);
@@ -33,7 +33,7 @@ class AnyConfigEntry {
     void subscribe(Listener listener);
 
     void reset() {
-        _value = _defaultValue;
+        setValue(_defaultValue);
     }
 
     std::string defaultString() const;
@@ -16,20 +16,32 @@ class ConfigEntry : public AnyConfigEntry {
  public:
     ConfigEntry(const ConfigEntry &other) = delete; // non-copyable
     ConfigEntry(ConfigEntry &&other) = delete; // non-movable
+    ConfigEntry &operator=(const ConfigEntry &other) = delete; // non-copyable
+    ConfigEntry &operator=(ConfigEntry &&other) = delete; // non-movable
 
     template<class TypedValidator>
     ConfigEntry(ConfigSection *section, const std::string &name, T defaultValue, TypedValidator validator, const std::string &description) :
-        AnyConfigEntry(section, name, description, AnyHandler::forType<T>(), defaultValue, wrapValidator(std::move(validator))) {}
+        AnyConfigEntry(section, name, description, AnyHandler::forType<T>(), defaultValue, wrapValidator(std::move(validator))),
+        _value(std::move(defaultValue)) {
+        subscribeCache();
+    }
 
     ConfigEntry(ConfigSection *section, const std::string &name, T defaultValue, const std::string &description) :
-        AnyConfigEntry(section, name, description, AnyHandler::forType<T>(), defaultValue, nullptr) {}
+        AnyConfigEntry(section, name, description, AnyHandler::forType<T>(), defaultValue, nullptr),
+        _value(std::move(defaultValue)) {
+        subscribeCache();
+    }
 
     const T &defaultValue() const {
         return std::any_cast<const T &>(AnyConfigEntry::defaultValue());
     }
 
+    /**
+     * @return                          Current value of this config entry. This is a plain read of a typed copy, so
+     *                                  it's fine to call this in hot loops.
+     */
     const T &value() const {
-        return std::any_cast<const T &>(AnyConfigEntry::value());
+        return _value;
     }
 
     void setValue(T value) {
@@ -72,6 +84,13 @@ class ConfigEntry : public AnyConfigEntry {
     }
 
  private:
+    void subscribeCache() {
+        // Subscribed first, so that the copy is already up to date when the other listeners are invoked.
+        subscribe([this] (const T &value) {
+            _value = value;
+        });
+    }
+
     template<class TypedValidator>
     static Validator wrapValidator(TypedValidator validator) {
         return [validator = std::move(validator)] (std::any value) {
@@ -85,4 +104,6 @@ class ConfigEntry : public AnyConfigEntry {
             listener(std::any_cast<const T &>(value));
         };
     }
+
+    T _value; // Typed copy of AnyConfigEntry::value(), kept in sync through a listener.
 };
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Config/Config.h"
+
+class TestConfig : public Config {
+ public:
+    class Section : public ConfigSection {
+     public:
+        explicit Section(TestConfig *config) : ConfigSection(config, "test") {}
+
+        ConfigEntry<bool> BoolValue = {this, "bool", false, "Bool entry."};
+        ConfigEntry<int> IntValue = {this, "int", 10, &ValidateInt, "Int entry, clamped to [0, 100]."};
+        ConfigEntry<std::string> StringValue = {this, "string", "default", "String entry."};
+
+     private:
+        static int ValidateInt(int value) {
+            return std::clamp(value, 0, 100);
+        }
+    };
+
+    Section section{this};
+};
+
+UNIT_TEST(Config, ValueTracksSetValue) {
+    TestConfig config;
+    EXPECT_EQ(config.section.IntValue.value(), 10);
+
+    config.section.IntValue.setValue(42);
+    EXPECT_EQ(config.section.IntValue.value(), 42);
+
+    config.section.IntValue.setValue(1000); // Goes through the validator.
+    EXPECT_EQ(config.section.IntValue.value(), 100);
+
+    config.section.BoolValue.toggle();
+    EXPECT_TRUE(config.section.BoolValue.value());
+
+    config.section.StringValue.setValue("other");
+    EXPECT_EQ(config.section.StringValue.value(), "other");
+}
+
+UNIT_TEST(Config, ValueTracksSetString) {
+    TestConfig config;
+
+    config.section.IntValue.setString("55");
+    EXPECT_EQ(config.section.IntValue.value(), 55);
+
+    config.section.IntValue.setString("-5");
+    EXPECT_EQ(config.section.IntValue.value(), 0);
+
+    config.section.BoolValue.setString("true");
+    EXPECT_TRUE(config.section.BoolValue.value());
+
+    config.section.StringValue.setString("from string");
+    EXPECT_EQ(config.section.StringValue.value(), "from string");
+}
+
+UNIT_TEST(Config, ValueTracksReset) {
+    TestConfig config;
+    config.section.IntValue.setValue(42);
+    config.section.BoolValue.setValue(true);
+    config.section.StringValue.setValue("other");
+
+    config.section.IntValue.reset();
+    EXPECT_EQ(config.section.IntValue.value(), 10);
+
+    config.reset();
+    EXPECT_FALSE(config.section.BoolValue.value());
+    EXPECT_EQ(config.section.StringValue.value(), "default");
+}
+
+UNIT_TEST(Config, ListenersSeeUpdatedValue) {
+    TestConfig config;
+
+    // Listeners are invoked on reset too, and value() is already up to date when they are.
+    std::vector<int> values;
+    config.section.IntValue.subscribe([&](int value) {
+        EXPECT_EQ(config.section.IntValue.value(), value);
+        values.push_back(value);
+    });
+
+    config.section.IntValue.setValue(42);
+    config.section.IntValue.setValue(42); // Not changed, no notification.
+    config.section.IntValue.setString("43");
+    config.reset();
+    EXPECT_EQ(values, std::vector<int>({42, 43, 10}));
+}
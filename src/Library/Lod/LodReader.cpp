@@ -1,18 +1,40 @@
 #include "LodReader.h"
 
-#include <algorithm>
-#include <cassert>
+#include <array>
+#include <cstring>
 #include <map>
+#include <system_error>
+#include <utility>
+#include <vector>
 
-// TODO(captainurist): errorhandling should be moved to utility/library out of the engine
-#include "Engine/ErrorHandling.h"
 #include "Library/Compression/Compression.h"
 #include "Library/Lod/Internal/LodDirectory.h"
 #include "Library/Lod/Internal/LodDirectoryHeader.h"
 #include "Library/Lod/Internal/LodFile.h"
 #include "Library/Lod/Internal/LodFileHeader.h"
 #include "Library/Lod/Internal/LodHeader.h"
+#include "Library/Profiler/Profiler.h"
+#include "Utility/Exception.h"
 #include "Utility/String.h"
+#include "Utility/ThreadPool.h"
+
+
+template<class T>
+static bool _lodReadStruct(const Blob &lod, size_t offset, T *out) {
+    if (offset > lod.size() || lod.size() - offset < sizeof(T))
+        return false;
+
+    memcpy(static_cast<void *>(out), static_cast<const char *>(lod.data()) + offset, sizeof(T));
+    return true;
+}
+
+
+template<size_t N>
+static std::string _lodReadString(const std::array<std::uint8_t, N> &data) {
+    // Fixed-size string fields are not guaranteed to be null-terminated in a corrupted LOD.
+    const char *chars = reinterpret_cast<const char *>(data.data());
+    return std::string(chars, strnlen(chars, N));
+}
 
 
 static inline size_t _getDirectoryHeaderImgSize(LodVersion lod_version) {
@@ -24,7 +46,7 @@ static inline size_t _getDirectoryHeaderImgSize(LodVersion lod_version) {
         return sizeof(LodDirectoryHeader_Mm6);
     }
 
-    Error("Unknown LOD version: %u", lod_version);
+    throw Exception("Unknown LOD version: {}", static_cast<int>(lod_version));
 }
 
 
@@ -36,25 +58,23 @@ static bool _lodHeaderParseVersion(const LodHeader_Mm6 &header, LodVersion &out_
         {"MMVIII",   LOD_VERSION_MM8},
     };
 
-    auto it = version_map.find((const char *)header.version.data());
+    auto it = version_map.find(_lodReadString(header.version));
     if (it != version_map.end()) {
         out_version = it->second;
         return true;
     }
 
-    Warn("Unknown LOD version: %s", (const char *)header.version.data());
     return false;
 }
 
 
-static bool _lodParseHeader(FILE *fp, LodVersion &out_version, std::string &out_description, size_t &out_num_expected_directories) {
+static bool _lodParseHeader(const Blob &lod, LodVersion &out_version, std::string &out_description, size_t &out_num_expected_directories) {
     LodHeader_Mm6 header;
-    if (1 != fread(&header, sizeof(header), 1, fp)) {
+    if (!_lodReadStruct(lod, 0, &header)) {
         return false;
     }
 
     if (memcmp(header.signature.data(), "LOD\0", sizeof(header.signature))) {
-        Warn("Not a LOD file");
         return false;
     }
 
@@ -64,31 +84,34 @@ static bool _lodParseHeader(FILE *fp, LodVersion &out_version, std::string &out_
     }
 
     out_version = version;
-    out_description = std::string((const char *)header.description.data());
+    out_description = _lodReadString(header.description);
     out_num_expected_directories = header.numDirectories;
     return true;
 }
 
 
-static inline void _lodParseDirectoryFiles(
-    FILE *fp,
+static inline bool _lodParseDirectoryFiles(
+    const Blob &lod,
     LodVersion version,
     LodDirectory &dir,
     size_t num_expected_files
 ) {
     dir.files.clear();
+    dir.files.reserve(num_expected_files);
 
-    fseek(fp, dir.fileHeadersOffset, SEEK_SET);
+    size_t read_ptr = dir.fileHeadersOffset;
     for (size_t i = 0; i < num_expected_files; ++i) {
         switch (version) {
         case LOD_VERSION_MM6:
         case LOD_VERSION_MM6_GAME:
         case LOD_VERSION_MM7: {
             LodFileHeader_Mm6 header;
-            assert(1 == fread(&header, sizeof(header), 1, fp));
+            if (!_lodReadStruct(lod, read_ptr, &header))
+                return false;
+            read_ptr += sizeof(header);
 
             LodFile file;
-            file.name = std::string((char *)header.name.data());
+            file.name = _lodReadString(header.name);
             file.dataOffset = dir.fileHeadersOffset + header.dataOffset;
             file.dataSize = header.size;
             dir.files.push_back(file);
@@ -97,129 +120,145 @@ static inline void _lodParseDirectoryFiles(
 
         case LOD_VERSION_MM8: {
             LodFileHeader_Mm8 header;
-            assert(1 == fread(&header, sizeof(header), 1, fp));
+            if (!_lodReadStruct(lod, read_ptr, &header))
+                return false;
+            read_ptr += sizeof(header);
 
             LodFile file;
-            file.name = std::string((char *)header.name.data());
+            file.name = _lodReadString(header.name);
             file.dataOffset = dir.fileHeadersOffset + header.dataOffset;
             file.dataSize = header.dataSize;
             dir.files.push_back(file);
             break;
         }
         }
+
+        // Negative MM8 offsets & sizes wrap around and are caught here too.
+        const LodFile &file = dir.files.back();
+        if (file.dataOffset > lod.size() || file.dataSize > lod.size() - file.dataOffset)
+            return false;
     }
+
+    return true;
 }
 
 
-static bool _lodParseDirectories(FILE *fp, LodVersion version, size_t num_expected_directories, std::vector<LodDirectory> &out_index) {
+static bool _lodParseDirectories(const Blob &lod, LodVersion version, size_t num_expected_directories, std::vector<LodDirectory> &out_index) {
     std::vector<LodDirectory> dirs;
 
     size_t read_size = _getDirectoryHeaderImgSize(version);
-    size_t items_read = 0;
 
-    size_t dir_read_ptr = ftell(fp);
+    size_t dir_read_ptr = sizeof(LodHeader_Mm6);
     for (size_t i = 0; i < num_expected_directories; ++i) {
         LodDirectoryHeader_Mm6 img;
-        fseek(fp, dir_read_ptr, SEEK_SET);
-        items_read += fread(&img, read_size, 1, fp);
+        if (!_lodReadStruct(lod, dir_read_ptr, &img))
+            return false;
         dir_read_ptr += read_size;
 
         LodDirectory dir;
-        dir.name = std::string((const char *)img.filename.data());
+        dir.name = _lodReadString(img.filename);
         dir.fileHeadersOffset = img.dataOffset;
-        _lodParseDirectoryFiles(fp, version, dir, img.numFiles);
+        if (!_lodParseDirectoryFiles(lod, version, dir, img.numFiles))
+            return false;
 
-        dirs.push_back(dir);
+        dirs.push_back(std::move(dir));
     }
 
-    out_index = dirs;
+    out_index = std::move(dirs);
     return true;
 }
 
 
 std::unique_ptr<LodReader> LodReader::open(const std::string &filename) {
     auto lod = std::make_unique<LodReader>();
-    if (nullptr == lod) {
-        Warn("LodReader::open: out of memory loading: %s", filename.c_str());
-        return nullptr;
-    }
 
-    auto fp = fopen(filename.c_str(), "rb");
-    if (nullptr == fp) {
-        Warn("LodReader::open: file not found: %s", filename.c_str());
-        return nullptr;
+    try {
+        lod->_lod = Blob::fromFile(filename);
+    } catch (const std::system_error &e) {
+        throw Exception("Could not open LOD file '{}': {}", filename, e.what());
     }
 
     size_t num_expected_directories = 0;
-    bool is_lod = _lodParseHeader(fp, lod->_version, lod->_description, num_expected_directories);
-    if (!is_lod) {
-        Warn("LodReader::open: invalid LOD file: %s", filename.c_str());
-        fclose(fp);
-        return nullptr;
+    bool is_lod = _lodParseHeader(lod->_lod, lod->_version, lod->_description, num_expected_directories);
+    if (!is_lod)
+        throw Exception("File '{}' is not a valid LOD", filename);
+
+    std::vector<LodDirectory> index;
+    bool is_index_ok = _lodParseDirectories(lod->_lod, lod->_version, num_expected_directories, index);
+    if (!is_index_ok || index.empty())
+        throw Exception("LOD file '{}' has a corrupted directory index", filename);
+
+    // Only the first dir is ever used, no matter the names.
+    // Note that emplace doesn't overwrite, so for duplicate names the first entry wins, as in a linear search.
+    std::vector<LodFile> &files = index.front().files;
+    lod->_files.reserve(files.size());
+    for (LodFile &file : files) {
+        std::string key = toLower(file.name);
+        lod->_files.emplace(std::move(key), std::move(file));
     }
 
-    bool is_index_ok = _lodParseDirectories(fp, lod->_version, num_expected_directories, lod->_index);
-    if (is_index_ok) {
-        lod->_fp = fp;
-        return lod;
-    }
-
-    Warn("LodReader::open: corrupt directory index: %s", filename.c_str());
-    fclose(fp);
-    return nullptr;
+    return lod;
 }
 
 
 bool LodReader::exists(const std::string &filename) const {
-    const auto &dir = _index.front(); // only first dir is ever used, no matter names
-    return dir.files.cend() != std::find_if(
-        dir.files.cbegin(),
-        dir.files.cend(),
-        [&](const LodFile &file) {return iequals(file.name, filename); }
-    );
+    return _find(filename) != nullptr;
 }
 
 
-Blob LodReader::read(const std::string &filename) {
-    const auto &dir = _index.front(); // only first dir is ever used, no matter names
-    const auto &file = std::find_if(
-        dir.files.cbegin(),
-        dir.files.cend(),
-        [&](const LodFile &file) {return iequals(file.name, filename); }
-    );
+Blob LodReader::read(const std::string &filename) const {
+    MM_PROFILE_ZONE("LodReader::read");
 
-    if (dir.files.cend() == file) {
-        Warn("LodReader::read: file not found: %s", filename.c_str());
-        return Blob();
-    }
+    const LodFile *file = _find(filename);
+    if (!file)
+        throw Exception("File '{}' not found in LOD", filename);
 
-    fseek(_fp, file->dataOffset, SEEK_SET);
     if (_isFileCompressed(*file)) {
         LodFileCompressionHeader_Mm6 header;
-        assert(1 == fread(&header, sizeof(header), 1, _fp));
+        _lodReadStruct(_lod, file->dataOffset, &header);
+
+        if (header.compressedSize > file->dataSize - sizeof(header))
+            throw Exception("File '{}' in LOD has a corrupted compression header", filename);
 
+        Blob data = _lod.subBlob(file->dataOffset + sizeof(header), header.compressedSize);
         if (0 != header.decompressedSize) {
-            return zlib::Uncompress(Blob::read(_fp, header.compressedSize), header.decompressedSize);
+            Blob result = zlib::Uncompress(data, header.decompressedSize);
+            if (result.size() == 0)
+                throw Exception("File '{}' in LOD could not be decompressed", filename);
+            return result;
         } else {
-            return Blob::read(_fp, header.compressedSize);
+            return data;
         }
     }
 
-    return Blob::read(_fp, file->dataSize);
+    return _lod.subBlob(file->dataOffset, file->dataSize);
+}
+
+
+std::vector<Blob> LodReader::readMany(const std::vector<std::string> &filenames, ThreadPool &pool) const {
+    std::vector<Blob> result(filenames.size());
+    pool.parallelFor(filenames.size(), [&](size_t i) {
+        result[i] = read(filenames[i]);
+    });
+    return result;
 }
 
 
-bool LodReader::_isFileCompressed(const LodFile &file) {
+const LodFile *LodReader::_find(std::string_view filename) const {
+    auto pos = _files.find(toLower(filename));
+    return pos == _files.end() ? nullptr : &pos->second;
+}
+
+
+bool LodReader::_isFileCompressed(const LodFile &file) const {
     if (file.dataSize <= sizeof(LodFileCompressionHeader_Mm6)) {
         return false;
     }
 
-    size_t prev_pos = ftell(_fp);
-    fseek(_fp, file.dataOffset, SEEK_SET);
-
     LodFileCompressionHeader_Mm6 header;
-    assert(1 == fread(&header, sizeof(header), 1, _fp));
-    fseek(_fp, prev_pos, SEEK_SET);
+    if (!_lodReadStruct(_lod, file.dataOffset, &header)) {
+        return false;
+    }
 
     return header.version == 91969 && !memcmp(header.signature.data(), "mvii", 4);
 }
@@ -2,39 +2,69 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Library/Lod/LodVersion.h"
-#include "Library/Lod/Internal/LodDirectory.h"
 #include "Library/Lod/Internal/LodFile.h"
 #include "Utility/Memory/Blob.h"
 
+class ThreadPool;
+
 
 /**
  * A single stop shop to read LOD files.
  * Even though LODs support a multi-directory structure, in reality vanilla games only ever had a single directory each.
- * 
+ *
  * Given that we don't plan to expand the LOD format support, when resolving the files this class always looks
  *      into the first available directory, which is consistent with the vanilla behaviour.
+ *
+ * The whole LOD file is memory-mapped on `open`, and file lookups go through a hash index keyed by lowercased file
+ * name. Uncompressed entries are returned as subblobs of the mapping, so no copying is involved.
+ *
+ * Once opened, a `LodReader` is never modified, so it's safe to call its methods from several threads at once.
  */
 class LodReader final {
  public:
+    /**
+     * @param filename                  Path to the LOD file to open.
+     * @return                          Newly created `LodReader`.
+     * @throws Exception                If the file could not be opened, or if it's not a valid LOD file.
+     */
     static std::unique_ptr<LodReader> open(const std::string &filename);
 
-    inline ~LodReader() {
-        if (nullptr != _fp) {
-            fclose(_fp);
-        }
-    }
-
+    /**
+     * @param filename                  Name of a file inside the LOD, case-insensitive.
+     * @return                          Whether the file exists.
+     */
     bool exists(const std::string &filename) const;
-    Blob read(const std::string &filename);
+
+    /**
+     * @param filename                  Name of a file inside the LOD, case-insensitive.
+     * @return                          Contents of the file. Compressed files are decompressed, uncompressed ones
+     *                                  are returned as subblobs of the memory-mapped LOD.
+     * @throws Exception                If the file doesn't exist, or if it couldn't be decompressed.
+     */
+    Blob read(const std::string &filename) const;
+
+    /**
+     * Reads several files at once, decompressing them in parallel.
+     *
+     * @param filenames                 Names of the files to read.
+     * @param pool                      Thread pool to run decompression on. Must not be the pool that's running
+     *                                  the calling code.
+     * @return                          Contents of the requested files, in the same order as `filenames`.
+     * @throws Exception                If any of the files couldn't be read.
+     */
+    std::vector<Blob> readMany(const std::vector<std::string> &filenames, ThreadPool &pool) const;
 
  private:
-    bool _isFileCompressed(const LodFile &file);
+    const LodFile *_find(std::string_view filename) const;
+    bool _isFileCompressed(const LodFile &file) const;
 
-    FILE *_fp;
+    Blob _lod;
     LodVersion _version;
     std::string _description;
-    std::vector<LodDirectory> _index;
+    std::unordered_map<std::string, LodFile> _files; // Files in the first directory, keyed by lowercased name.
 };
@@ -0,0 +1,294 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Compression/Compression.h"
+#include "Library/Lod/LodReader.h"
+#include "Library/Lod/Internal/LodDirectoryHeader.h"
+#include "Library/Lod/Internal/LodFileHeader.h"
+#include "Library/Lod/Internal/LodHeader.h"
+#include "Utility/Exception.h"
+#include "Utility/Format.h"
+#include "Utility/ThreadPool.h"
+
+struct TestLodEntry {
+    std::string name;
+    std::string data;
+    bool compressed = false;
+};
+
+template<size_t N>
+static void setString(std::array<std::uint8_t, N> *dst, const std::string &src) {
+    memcpy(dst->data(), src.data(), std::min(N, src.size()));
+}
+
+template<class T>
+static void appendStruct(std::string *dst, const T &src) {
+    dst->append(reinterpret_cast<const char *>(&src), sizeof(T));
+}
+
+static std::string makeLod(const std::vector<TestLodEntry> &files, const std::string &version = "MMVII") {
+    LodHeader_Mm6 header;
+    setString(&header.signature, std::string("LOD\0", 4));
+    setString(&header.version, version);
+    setString(&header.description, "Test LOD");
+    header.numDirectories = 1;
+
+    size_t fileHeadersOffset = sizeof(LodHeader_Mm6) + sizeof(LodDirectoryHeader_Mm6);
+
+    LodDirectoryHeader_Mm6 directory;
+    setString(&directory.filename, "data");
+    directory.dataOffset = fileHeadersOffset;
+    directory.numFiles = files.size();
+
+    std::string fileHeaders, fileData;
+    for (const TestLodEntry &file : files) {
+        std::string data = file.data;
+        if (file.compressed) {
+            Blob compressed = zlib::Compress(Blob::fromString(file.data));
+            LodFileCompressionHeader_Mm6 compression;
+            compression.version = 91969;
+            setString(&compression.signature, "mvii");
+            compression.compressedSize = compressed.size();
+            compression.decompressedSize = file.data.size();
+
+            data.clear();
+            appendStruct(&data, compression);
+            data += compressed.string_view();
+        }
+
+        LodFileHeader_Mm6 fileHeader;
+        setString(&fileHeader.name, file.name);
+        fileHeader.dataOffset = files.size() * sizeof(LodFileHeader_Mm6) + fileData.size();
+        fileHeader.size = data.size();
+        appendStruct(&fileHeaders, fileHeader);
+        fileData += data;
+    }
+
+    std::string result;
+    appendStruct(&result, header);
+    appendStruct(&result, directory);
+    return result + fileHeaders + fileData;
+}
+
+class TestLod {
+ public:
+    explicit TestLod(const std::string &data) {
+        _path = (std::filesystem::temp_directory_path() / "lod_reader_ut.lod").string();
+        std::ofstream(_path, std::ios_base::binary | std::ios_base::trunc) << data;
+    }
+
+    ~TestLod() {
+        std::error_code ec;
+        std::filesystem::remove(_path, ec);
+    }
+
+    const std::string &path() const {
+        return _path;
+    }
+
+ private:
+    std::string _path;
+};
+
+static const std::vector<TestLodEntry> testFiles = {
+    {"Plain", "plain file contents"},
+    {"packed", std::string(1000, 'x') + "packed file contents", true},
+    {"empty", ""},
+    {"dupe", "first"},
+    {"DUPE", "second"},
+};
+
+UNIT_TEST(LodReader, Read) {
+    TestLod lod(makeLod(testFiles));
+    std::unique_ptr<LodReader> reader = LodReader::open(lod.path());
+    ASSERT_TRUE(reader);
+
+    EXPECT_TRUE(reader->exists("plain"));
+    EXPECT_TRUE(reader->exists("PLAIN"));
+    EXPECT_TRUE(reader->exists("Packed"));
+    EXPECT_TRUE(reader->exists("empty"));
+    EXPECT_FALSE(reader->exists("missing"));
+    EXPECT_FALSE(reader->exists("plai"));
+    EXPECT_FALSE(reader->exists(""));
+
+    EXPECT_EQ(reader->read("pLaIn").string_view(), "plain file contents");
+    EXPECT_EQ(reader->read("PACKED").string_view(), std::string(1000, 'x') + "packed file contents");
+    EXPECT_EQ(reader->read("empty").size(), 0);
+    EXPECT_EQ(reader->read("Dupe").string_view(), "first"); // First one wins, same as in a linear search.
+    EXPECT_THROW((void) reader->read("missing"), Exception);
+}
+
+UNIT_TEST(LodReader, Mapped) {
+    TestLod lod(makeLod(testFiles));
+    std::unique_ptr<LodReader> reader = LodReader::open(lod.path());
+    ASSERT_TRUE(reader);
+
+    // Uncompressed files are views into the same mapping, not copies.
+    Blob plain0 = reader->read("plain");
+    Blob plain1 = reader->read("plain");
+    EXPECT_EQ(plain0.data(), plain1.data());
+
+    // Compressed files are not.
+    Blob packed0 = reader->read("packed");
+    Blob packed1 = reader->read("packed");
+    EXPECT_NE(packed0.data(), packed1.data());
+
+    // Views keep the mapping alive.
+    reader.reset();
+    EXPECT_EQ(plain0.string_view(), "plain file contents");
+}
+
+UNIT_TEST(LodReader, ConcurrentReads) {
+    std::vector<TestLodEntry> files;
+    for (int i = 0; i < 100; i++)
+        files.push_back({fmt::format("file{}", i), std::string(1000 + i, static_cast<char>('a' + i % 26)), i % 2 == 0});
+
+    TestLod lod(makeLod(files));
+    std::unique_ptr<LodReader> reader = LodReader::open(lod.path());
+    ASSERT_TRUE(reader);
+
+    ThreadPool pool(4);
+    std::vector<Blob> results(files.size() * 10);
+    pool.parallelFor(results.size(), [&](size_t i) {
+        results[i] = reader->read(files[i % files.size()].name);
+    });
+
+    for (size_t i = 0; i < results.size(); i++)
+        EXPECT_EQ(results[i].string_view(), files[i % files.size()].data);
+}
+
+UNIT_TEST(LodReader, ReadMany) {
+    TestLod lod(makeLod(testFiles));
+    std::unique_ptr<LodReader> reader = LodReader::open(lod.path());
+    ASSERT_TRUE(reader);
+
+    ThreadPool pool(2);
+    std::vector<Blob> results = reader->readMany({"packed", "plain", "empty", "packed"}, pool);
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_EQ(results[0].string_view(), std::string(1000, 'x') + "packed file contents");
+    EXPECT_EQ(results[1].string_view(), "plain file contents");
+    EXPECT_EQ(results[2].size(), 0);
+    EXPECT_EQ(results[3].string_view(), results[0].string_view());
+
+    EXPECT_TRUE(reader->readMany({}, pool).empty());
+    EXPECT_THROW((void) reader->readMany({"plain", "missing"}, pool), Exception);
+}
+
+UNIT_TEST(LodReader, Versions) {
+    for (const char *version : {"MMVI", "GameMMVI", "MMVII"}) {
+        TestLod lod(makeLod(testFiles, version));
+        std::unique_ptr<LodReader> reader = LodReader::open(lod.path());
+        ASSERT_TRUE(reader);
+        EXPECT_EQ(reader->read("plain").string_view(), "plain file contents");
+    }
+
+    TestLod lod(makeLod(testFiles, "MMIX"));
+    EXPECT_THROW((void) LodReader::open(lod.path()), Exception);
+}
+
+UNIT_TEST(LodReader, Missing) {
+    EXPECT_THROW((void) LodReader::open((std::filesystem::temp_directory_path() / "lod_reader_ut_missing.lod").string()), Exception);
+}
+
+UNIT_TEST(LodReader, Truncated) {
+    std::string data = makeLod(testFiles);
+
+    // Every truncation cuts into either the headers or the data of the last file.
+    for (size_t size = 0; size < data.size(); size++) {
+        TestLod lod(data.substr(0, size));
+        EXPECT_THROW((void) LodReader::open(lod.path()), Exception) << "Size " << size;
+    }
+}
+
+UNIT_TEST(LodReader, Corrupted) {
+    std::string data = makeLod(testFiles);
+
+    // Bad signature.
+    {
+        std::string broken = data;
+        broken[0] = 'X';
+        TestLod lod(broken);
+        EXPECT_THROW((void) LodReader::open(lod.path()), Exception);
+    }
+
+    // Version & description that are not null-terminated.
+    {
+        std::string broken = data;
+        LodHeader_Mm6 header;
+        memcpy(&header, broken.data(), sizeof(header));
+        header.version.fill('M');
+        header.description.fill('D');
+        memcpy(broken.data(), &header, sizeof(header));
+        TestLod lod(broken);
+        EXPECT_THROW((void) LodReader::open(lod.path()), Exception);
+    }
+
+    // No directories.
+    {
+        std::string broken = data;
+        LodHeader_Mm6 header;
+        memcpy(&header, broken.data(), sizeof(header));
+        header.numDirectories = 0;
+        memcpy(broken.data(), &header, sizeof(header));
+        TestLod lod(broken);
+        EXPECT_THROW((void) LodReader::open(lod.path()), Exception);
+    }
+
+    // File data out of bounds.
+    for (uint32_t LodFileHeader_Mm6::*field : {&LodFileHeader_Mm6::dataOffset, &LodFileHeader_Mm6::size}) {
+        std::string broken = data;
+        size_t offset = sizeof(LodHeader_Mm6) + sizeof(LodDirectoryHeader_Mm6);
+        LodFileHeader_Mm6 header;
+        memcpy(&header, broken.data() + offset, sizeof(header));
+        header.*field = 0xFFFFFFF0;
+        memcpy(broken.data() + offset, &header, sizeof(header));
+        TestLod lod(broken);
+        EXPECT_THROW((void) LodReader::open(lod.path()), Exception);
+    }
+
+    // Compression header claims more data than there is.
+    {
+        std::string broken = data;
+        size_t offset = sizeof(LodHeader_Mm6) + sizeof(LodDirectoryHeader_Mm6) + sizeof(LodFileHeader_Mm6);
+        LodFileHeader_Mm6 header;
+        memcpy(&header, broken.data() + offset, sizeof(header));
+        size_t dataOffset = sizeof(LodHeader_Mm6) + sizeof(LodDirectoryHeader_Mm6) + header.dataOffset;
+
+        LodFileCompressionHeader_Mm6 compression;
+        memcpy(&compression, broken.data() + dataOffset, sizeof(compression));
+        compression.compressedSize = header.size;
+        memcpy(broken.data() + dataOffset, &compression, sizeof(compression));
+
+        TestLod lod(broken);
+        std::unique_ptr<LodReader> reader = LodReader::open(lod.path());
+        ASSERT_TRUE(reader);
+        EXPECT_THROW((void) reader->read("packed"), Exception);
+        EXPECT_EQ(reader->read("plain").string_view(), "plain file contents");
+    }
+
+    // Garbage instead of compressed data.
+    {
+        std::string broken = data;
+        size_t offset = sizeof(LodHeader_Mm6) + sizeof(LodDirectoryHeader_Mm6) + sizeof(LodFileHeader_Mm6);
+        LodFileHeader_Mm6 header;
+        memcpy(&header, broken.data() + offset, sizeof(header));
+        size_t dataOffset = sizeof(LodHeader_Mm6) + sizeof(LodDirectoryHeader_Mm6) + header.dataOffset;
+        memset(broken.data() + dataOffset + sizeof(LodFileCompressionHeader_Mm6), 0xAB, header.size - sizeof(LodFileCompressionHeader_Mm6));
+
+        TestLod lod(broken);
+        std::unique_ptr<LodReader> reader = LodReader::open(lod.path());
+        ASSERT_TRUE(reader);
+        EXPECT_THROW((void) reader->read("packed"), Exception);
+    }
+}
@@ -0,0 +1,160 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Library/Json/Json.h"
+
+#include "Utility/Streams/FileOutputStream.h"
+
+struct ProfilerEvent {
+    const char *name;
+    int64_t startNs;
+    int64_t endNs;
+};
+
+/**
+ * Ring buffer of the events recorded on a single thread. The mutex is only ever contended when the events are being
+ * collected, so the owning thread doesn't pay much for it.
+ */
+struct ProfilerBuffer {
+    explicit ProfilerBuffer(int threadId) : threadId(threadId) {
+        events.reserve(Profiler::BUFFER_CAPACITY);
+    }
+
+    int threadId;
+    std::mutex mutex;
+    std::vector<ProfilerEvent> events;
+    size_t next = 0; // Next slot to overwrite once `events` is full.
+};
+
+struct ProfilerRegistry {
+    std::mutex mutex;
+    // Buffers are never removed, so that events recorded on threads that have already exited still show up in dumps.
+    std::vector<std::shared_ptr<ProfilerBuffer>> buffers;
+};
+
+static ProfilerRegistry &registry() {
+    static ProfilerRegistry result;
+    return result;
+}
+
+static ProfilerBuffer &threadBuffer() {
+    thread_local std::shared_ptr<ProfilerBuffer> buffer = [] {
+        ProfilerRegistry &registry = ::registry();
+        std::lock_guard lock(registry.mutex);
+        registry.buffers.push_back(std::make_shared<ProfilerBuffer>(registry.buffers.size()));
+        return registry.buffers.back();
+    }();
+    return *buffer;
+}
+
+static std::vector<std::shared_ptr<ProfilerBuffer>> allBuffers() {
+    ProfilerRegistry &registry = ::registry();
+    std::lock_guard lock(registry.mutex);
+    return registry.buffers;
+}
+
+std::atomic<bool> Profiler::_enabled = false;
+
+void Profiler::setEnabled(bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+int64_t Profiler::now() {
+    static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void Profiler::record(const char *name, int64_t startNs, int64_t endNs) {
+    ProfilerBuffer &buffer = threadBuffer();
+    std::lock_guard lock(buffer.mutex);
+
+    if (buffer.events.size() < BUFFER_CAPACITY) {
+        buffer.events.push_back({name, startNs, endNs});
+    } else {
+        buffer.events[buffer.next] = {name, startNs, endNs};
+        buffer.next = (buffer.next + 1) % BUFFER_CAPACITY;
+    }
+}
+
+void Profiler::clear() {
+    for (const std::shared_ptr<ProfilerBuffer> &buffer : allBuffers()) {
+        std::lock_guard lock(buffer->mutex);
+        buffer->events.clear();
+        buffer->next = 0;
+    }
+}
+
+std::vector<ProfilerZoneStats> Profiler::stats(int64_t windowNs) {
+    int64_t minEndNs = now() - windowNs;
+
+    // Zone names are literals, so they are keyed by pointer. Literals with the same contents might end up with
+    // different addresses in different translation units, so the results are then merged by contents.
+    std::unordered_map<const char *, ProfilerZoneStats> statsByPointer;
+    for (const std::shared_ptr<ProfilerBuffer> &buffer : allBuffers()) {
+        std::lock_guard lock(buffer->mutex);
+        for (const ProfilerEvent &event : buffer->events) {
+            if (event.endNs < minEndNs)
+                continue;
+
+            ProfilerZoneStats &stats = statsByPointer[event.name];
+            int64_t durationNs = event.endNs - event.startNs;
+            stats.name = event.name;
+            stats.count++;
+            stats.totalNs += durationNs;
+            stats.maxNs = std::max(stats.maxNs, durationNs);
+        }
+    }
+
+    std::unordered_map<std::string_view, ProfilerZoneStats> statsByName;
+    for (const auto &[_, stats] : statsByPointer) {
+        ProfilerZoneStats &merged = statsByName[stats.name];
+        merged.name = stats.name;
+        merged.count += stats.count;
+        merged.totalNs += stats.totalNs;
+        merged.maxNs = std::max(merged.maxNs, stats.maxNs);
+    }
+
+    std::vector<ProfilerZoneStats> result;
+    result.reserve(statsByName.size());
+    for (const auto &[_, stats] : statsByName)
+        result.push_back(stats);
+    std::sort(result.begin(), result.end(), [](const ProfilerZoneStats &l, const ProfilerZoneStats &r) {
+        return l.totalNs > r.totalNs;
+    });
+    return result;
+}
+
+size_t Profiler::dumpChromeTrace(std::string_view path) {
+    // Each zone run is written out as a complete ("X") event, timestamps & durations are in microseconds.
+    Json events = Json::array();
+    for (const std::shared_ptr<ProfilerBuffer> &buffer : allBuffers()) {
+        std::lock_guard lock(buffer->mutex);
+        for (const ProfilerEvent &event : buffer->events) {
+            events.push_back({
+                {"name", event.name},
+                {"ph", "X"},
+                {"ts", event.startNs / 1000.0},
+                {"dur", (event.endNs - event.startNs) / 1000.0},
+                {"pid", 0},
+                {"tid", buffer->threadId}
+            });
+        }
+    }
+
+    size_t result = events.size();
+
+    Json json;
+    json["traceEvents"] = std::move(events);
+    json["displayTimeUnit"] = "ns";
+
+    FileOutputStream output(path);
+    output.write(json.dump());
+    output.close();
+    return result;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Utility/Preprocessor.h"
+
+/**
+ * Per-zone timings, as returned by `Profiler::stats`.
+ */
+struct ProfilerZoneStats {
+    const char *name = nullptr;
+    int64_t count = 0; // Number of times the zone was entered.
+    int64_t totalNs = 0; // Total time spent in the zone, in nanoseconds.
+    int64_t maxNs = 0; // Longest single run of the zone, in nanoseconds.
+};
+
+/**
+ * Lightweight scoped-zone profiler.
+ *
+ * Zones are recorded into per-thread ring buffers, so recording never blocks on other threads, and only the latest
+ * events are kept around. Recording is off by default, and zones are close to free until it's turned on with
+ * `setEnabled`.
+ *
+ * Zones are normally declared with the `MM_PROFILE_ZONE` macro, which compiles into nothing unless
+ * `MM_ENABLE_PROFILER` is defined.
+ *
+ * Example usage:
+ * \code
+ * void UpdateObjects() {
+ *     MM_PROFILE_ZONE("UpdateObjects");
+ *     ...
+ * }
+ * \endcode
+ */
+class Profiler {
+ public:
+    /**
+     * Number of events kept in each of the per-thread ring buffers.
+     */
+    static constexpr size_t BUFFER_CAPACITY = 65536;
+
+    [[nodiscard]] static bool isEnabled() {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    static void setEnabled(bool enabled);
+
+    /**
+     * @return                          Current time in nanoseconds, on the same clock as the recorded events.
+     */
+    [[nodiscard]] static int64_t now();
+
+    /**
+     * Records a single zone run on the calling thread.
+     *
+     * @param name                      Zone name. Not copied, must be a string literal or have static storage
+     *                                  duration otherwise.
+     * @param startNs                   Zone start time, as returned by `now`.
+     * @param endNs                     Zone end time, as returned by `now`.
+     */
+    static void record(const char *name, int64_t startNs, int64_t endNs);
+
+    /**
+     * Drops all recorded events.
+     */
+    static void clear();
+
+    /**
+     * @param windowNs                  Time window to collect stats for, only the events that ended within the last
+     *                                  `windowNs` nanoseconds are accounted for.
+     * @return                          Per-zone stats over all threads, sorted by total time, descending.
+     */
+    [[nodiscard]] static std::vector<ProfilerZoneStats> stats(int64_t windowNs);
+
+    /**
+     * Writes out all recorded events in Chrome `trace_event` format, suitable for `chrome://tracing` or Perfetto.
+     *
+     * @param path                      Path to the output file.
+     * @return                          Number of events written.
+     * @throws std::exception           On IO errors.
+     */
+    static size_t dumpChromeTrace(std::string_view path);
+
+ private:
+    static std::atomic<bool> _enabled;
+};
+
+/**
+ * RAII zone recorder, you're probably looking for `MM_PROFILE_ZONE` instead.
+ */
+class ProfilerScope {
+ public:
+    explicit ProfilerScope(const char *name) {
+        if (Profiler::isEnabled()) {
+            _name = name;
+            _startNs = Profiler::now();
+        }
+    }
+
+    ~ProfilerScope() {
+        if (_name)
+            Profiler::record(_name, _startNs, Profiler::now());
+    }
+
+    ProfilerScope(const ProfilerScope &) = delete;
+    ProfilerScope &operator=(const ProfilerScope &) = delete;
+
+ private:
+    const char *_name = nullptr;
+    int64_t _startNs = 0;
+};
+
+#ifdef MM_ENABLE_PROFILER
+/**
+ * Records the time from this point to the end of the enclosing scope as a profiler zone.
+ *
+ * @param NAME                          Zone name, must be a string literal.
+ */
+#   define MM_PROFILE_ZONE(NAME) ProfilerScope MM_PP_CAT(profilerScope, __LINE__)(NAME)
+#else
+#   define MM_PROFILE_ZONE(NAME) ((void) 0)
+#endif
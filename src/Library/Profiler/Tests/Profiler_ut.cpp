@@ -0,0 +1,76 @@
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Json/Json.h"
+#include "Library/Profiler/Profiler.h"
+
+#include "Utility/Memory/Blob.h"
+
+UNIT_TEST(Profiler, Stats) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+
+    for (int i = 0; i < 3; i++)
+        ProfilerScope scope("a");
+    std::thread([] {
+        int64_t now = Profiler::now();
+        Profiler::record("b", now - 200, now - 100);
+        Profiler::record("a", now - 1000, now);
+    }).join();
+
+    Profiler::setEnabled(false);
+    ProfilerScope("a"); // Not recorded.
+
+    std::vector<ProfilerZoneStats> stats = Profiler::stats(1'000'000'000);
+    ASSERT_EQ(stats.size(), 2);
+    EXPECT_EQ(std::string(stats[0].name), "a");
+    EXPECT_EQ(stats[0].count, 4);
+    EXPECT_GE(stats[0].maxNs, 1000);
+    EXPECT_EQ(std::string(stats[1].name), "b");
+    EXPECT_EQ(stats[1].count, 1);
+    EXPECT_EQ(stats[1].totalNs, 100);
+
+    Profiler::clear();
+    EXPECT_TRUE(Profiler::stats(1'000'000'000).empty());
+}
+
+UNIT_TEST(Profiler, RingBuffer) {
+    Profiler::clear();
+
+    int64_t now = Profiler::now();
+    for (size_t i = 0; i < Profiler::BUFFER_CAPACITY + 10; i++)
+        Profiler::record("a", now, now + 1);
+
+    std::vector<ProfilerZoneStats> stats = Profiler::stats(1'000'000'000);
+    ASSERT_EQ(stats.size(), 1);
+    EXPECT_EQ(stats[0].count, Profiler::BUFFER_CAPACITY);
+
+    Profiler::clear();
+}
+
+UNIT_TEST(Profiler, ChromeTrace) {
+    std::string path = (std::filesystem::temp_directory_path() / "profiler_ut.json").string();
+
+    Profiler::clear();
+    Profiler::record("zone", 1000, 3500);
+    EXPECT_EQ(Profiler::dumpChromeTrace(path), 1);
+    Profiler::clear();
+
+    Json json;
+    {
+        Blob blob = Blob::fromFile(path);
+        json = Json::parse(blob.string_view());
+    }
+    ASSERT_EQ(json["traceEvents"].size(), 1);
+    const Json &event = json["traceEvents"][0];
+    EXPECT_EQ(event["name"], "zone");
+    EXPECT_EQ(event["ph"], "X");
+    EXPECT_EQ(event["ts"], 1.0);
+    EXPECT_EQ(event["dur"], 2.5);
+
+    std::filesystem::remove(path);
+}
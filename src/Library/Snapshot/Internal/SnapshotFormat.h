@@ -0,0 +1,24 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+static constexpr std::array<char, 8> SNAPSHOT_MAGIC = {'O', 'E', 'S', 'N', 'A', 'P', 'S', 'H'};
+static constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+#pragma pack(push, 1)
+struct SnapshotHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint64_t fingerprint;
+    uint64_t indexChecksum; // Checksum of the entry table that follows the header.
+};
+
+struct SnapshotEntry {
+    std::array<char, 64> name; // Zero-terminated.
+    uint64_t offset; // From the start of the file.
+    uint64_t size;
+    uint64_t checksum;
+};
+#pragma pack(pop)
@@ -0,0 +1,24 @@
+#include "SnapshotChecksum.h"
+
+#include <cstring>
+
+uint64_t snapshotChecksum(const void *data, size_t size) {
+    // FNV-1a, but over 8-byte words. Not as well-distributed as the original, but several times faster, and we only
+    // need to detect corruption & changes.
+    const char *pos = static_cast<const char *>(data);
+    const char *end = pos + size;
+
+    uint64_t result = 14695981039346656037ull ^ size;
+    for (; end - pos >= 8; pos += 8) {
+        uint64_t word;
+        memcpy(&word, pos, 8);
+        result ^= word;
+        result *= 1099511628211ull;
+        result ^= result >> 29;
+    }
+    for (; pos < end; pos++) {
+        result ^= static_cast<unsigned char>(*pos);
+        result *= 1099511628211ull;
+    }
+    return result;
+}
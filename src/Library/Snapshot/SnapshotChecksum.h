@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Fast non-cryptographic 64-bit checksum, used both for snapshot contents and for fingerprinting snapshot sources.
+ *
+ * @param data                          Data to checksum.
+ * @param size                          Data size, in bytes.
+ * @return                              Checksum of the provided data.
+ */
+uint64_t snapshotChecksum(const void *data, size_t size);
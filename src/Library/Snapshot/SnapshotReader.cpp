@@ -0,0 +1,61 @@
+#include "SnapshotReader.h"
+
+#include <cstring>
+#include <system_error>
+#include <vector>
+
+#include "Library/Snapshot/Internal/SnapshotFormat.h"
+#include "Library/Snapshot/SnapshotChecksum.h"
+
+std::unique_ptr<SnapshotReader> SnapshotReader::open(const std::string &path, uint64_t fingerprint) {
+    auto result = std::make_unique<SnapshotReader>();
+
+    try {
+        result->_snapshot = Blob::fromFile(path);
+    } catch (const std::system_error &) {
+        return nullptr;
+    }
+
+    const Blob &snapshot = result->_snapshot;
+
+    SnapshotHeader header;
+    if (snapshot.size() < sizeof(header))
+        return nullptr;
+    memcpy(&header, snapshot.data(), sizeof(header));
+
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION || header.fingerprint != fingerprint)
+        return nullptr;
+
+    size_t indexSize = sizeof(SnapshotEntry) * header.entryCount;
+    if (snapshot.size() - sizeof(header) < indexSize)
+        return nullptr;
+
+    std::vector<SnapshotEntry> index(header.entryCount);
+    memcpy(index.data(), static_cast<const char *>(snapshot.data()) + sizeof(header), indexSize);
+    if (snapshotChecksum(index.data(), indexSize) != header.indexChecksum)
+        return nullptr;
+
+    for (const SnapshotEntry &entry : index) {
+        if (entry.offset > snapshot.size() || snapshot.size() - entry.offset < entry.size)
+            return nullptr;
+        if (entry.name.back() != '\0')
+            return nullptr;
+
+        Blob data = snapshot.subBlob(entry.offset, entry.size);
+        if (snapshotChecksum(data.data(), data.size()) != entry.checksum)
+            return nullptr;
+
+        result->_entries.emplace(std::string(entry.name.data()), std::move(data));
+    }
+
+    return result;
+}
+
+Blob SnapshotReader::read(std::string_view name) const {
+    auto pos = _entries.find(std::string(name));
+    return pos == _entries.end() ? Blob() : Blob::share(pos->second);
+}
+
+bool SnapshotReader::exists(std::string_view name) const {
+    return _entries.contains(std::string(name));
+}
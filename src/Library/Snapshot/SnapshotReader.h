@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Utility/Memory/Blob.h"
+
+/**
+ * Reader for snapshot files written by `SnapshotWriter`.
+ *
+ * The snapshot file is memory-mapped, and all the checksums are verified on `open`. Entries are returned as subblobs
+ * of the mapping, so reading is zero-copy. Once opened, a `SnapshotReader` is never modified, so it's safe to use it
+ * from several threads at once.
+ */
+class SnapshotReader {
+ public:
+    /**
+     * @param path                      Path to the snapshot file.
+     * @param fingerprint               Expected fingerprint of the source data.
+     * @return                          Snapshot reader, or `nullptr` if the file doesn't exist, is corrupted, was
+     *                                  written by an incompatible version, or has a different fingerprint.
+     */
+    static std::unique_ptr<SnapshotReader> open(const std::string &path, uint64_t fingerprint);
+
+    /**
+     * @param name                      Name of the entry to read.
+     * @return                          Entry data, or an empty blob if there is no such entry. Note that empty entries
+     *                                  are also returned as empty blobs.
+     */
+    [[nodiscard]] Blob read(std::string_view name) const;
+
+    [[nodiscard]] bool exists(std::string_view name) const;
+
+    [[nodiscard]] size_t size() const {
+        return _entries.size();
+    }
+
+ private:
+    Blob _snapshot;
+    std::unordered_map<std::string, Blob> _entries;
+};
@@ -0,0 +1,58 @@
+#include "SnapshotWriter.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+
+#include "Library/Snapshot/Internal/SnapshotFormat.h"
+#include "Library/Snapshot/SnapshotChecksum.h"
+
+#include "Utility/Streams/FileOutputStream.h"
+
+void SnapshotWriter::add(const std::string &name, const Blob &data) {
+    assert(name.size() < sizeof(SnapshotEntry::name));
+
+    if (std::any_of(_entries.begin(), _entries.end(), [&](const Entry &entry) { return entry.name == name; }))
+        return;
+
+    // Data is copied so that snapshot doesn't pin the memory of whatever the blob is viewing into.
+    _entries.push_back({name, Blob::copy(data.data(), data.size())});
+}
+
+void SnapshotWriter::write(const std::string &path) const {
+    std::vector<SnapshotEntry> index(_entries.size());
+
+    uint64_t offset = sizeof(SnapshotHeader) + sizeof(SnapshotEntry) * index.size();
+    for (size_t i = 0; i < _entries.size(); i++) {
+        SnapshotEntry &entry = index[i];
+        memset(&entry, 0, sizeof(entry));
+        memcpy(entry.name.data(), _entries[i].name.data(), _entries[i].name.size());
+        entry.offset = offset;
+        entry.size = _entries[i].data.size();
+        entry.checksum = snapshotChecksum(_entries[i].data.data(), _entries[i].data.size());
+        offset += entry.size;
+    }
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.entryCount = index.size();
+    header.fingerprint = _fingerprint;
+    header.indexChecksum = snapshotChecksum(index.data(), sizeof(SnapshotEntry) * index.size());
+
+    std::string tmpPath = path + ".tmp";
+    {
+        FileOutputStream output(tmpPath);
+        output.write(&header, sizeof(header));
+        if (!index.empty())
+            output.write(index.data(), sizeof(SnapshotEntry) * index.size());
+        for (const Entry &entry : _entries)
+            if (entry.data.size() > 0) // Zero-sized writes fail in FileOutputStream.
+                output.write(entry.data.data(), entry.data.size());
+        output.close();
+    }
+
+    std::filesystem::rename(tmpPath, path); // Throws std::filesystem::filesystem_error, which is a runtime_error.
+}
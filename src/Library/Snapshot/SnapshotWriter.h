@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Utility/Memory/Blob.h"
+
+/**
+ * Writer for snapshot files - versioned & checksummed named blob archives that are meant to be memory-mapped on
+ * read, see `SnapshotReader`.
+ *
+ * Snapshots are meant for caching data that is expensive to get to, e.g. decompressed files from LOD archives. Each
+ * snapshot carries a fingerprint of the data it was created from, so that readers can check that it's not stale.
+ */
+class SnapshotWriter {
+ public:
+    /**
+     * @param fingerprint               Fingerprint of the source data.
+     */
+    explicit SnapshotWriter(uint64_t fingerprint) : _fingerprint(fingerprint) {}
+
+    /**
+     * Adds an entry to the snapshot. Entries with names that are already in the snapshot are ignored.
+     *
+     * @param name                      Entry name, must be shorter than 64 characters. Names are case-sensitive.
+     * @param data                      Entry data.
+     */
+    void add(const std::string &name, const Blob &data);
+
+    /**
+     * Writes out the snapshot. The file is written under a temporary name first and then renamed, so readers never
+     * see a partially written snapshot.
+     *
+     * @param path                      Path to write to.
+     * @throws std::runtime_error       On error.
+     */
+    void write(const std::string &path) const;
+
+ private:
+    struct Entry {
+        std::string name;
+        Blob data;
+    };
+
+    uint64_t _fingerprint = 0;
+    std::vector<Entry> _entries;
+};
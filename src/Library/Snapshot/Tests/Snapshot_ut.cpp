@@ -0,0 +1,56 @@
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Snapshot/SnapshotReader.h"
+#include "Library/Snapshot/SnapshotWriter.h"
+
+#include "Utility/Streams/FileOutputStream.h"
+
+UNIT_TEST(Snapshot, RoundTrip) {
+    std::string path = (std::filesystem::temp_directory_path() / "snapshot_ut.snapshot").string();
+
+    SnapshotWriter writer(42);
+    writer.add("a.txt", Blob::fromString("aaaa"));
+    writer.add("b.bin", Blob::fromString(std::string(1000, 'b')));
+    writer.add("a.txt", Blob::fromString("ignored"));
+    writer.add("empty", Blob());
+    writer.write(path);
+
+    std::unique_ptr<SnapshotReader> reader = SnapshotReader::open(path, 42);
+    ASSERT_NE(reader, nullptr);
+    EXPECT_EQ(reader->size(), 3);
+    EXPECT_EQ(reader->read("a.txt").string_view(), "aaaa");
+    EXPECT_EQ(reader->read("b.bin").string_view(), std::string(1000, 'b'));
+    EXPECT_TRUE(reader->exists("empty"));
+    EXPECT_FALSE(reader->exists("A.TXT"));
+    EXPECT_FALSE(reader->read("c.txt"));
+
+    EXPECT_EQ(SnapshotReader::open(path, 43), nullptr); // Wrong fingerprint.
+
+    reader.reset();
+    std::filesystem::remove(path);
+}
+
+UNIT_TEST(Snapshot, Corrupted) {
+    std::string path = (std::filesystem::temp_directory_path() / "snapshot_ut_corrupted.snapshot").string();
+
+    SnapshotWriter writer(1);
+    writer.add("a.txt", Blob::fromString("aaaa"));
+    writer.write(path);
+
+    // Flip the last byte of the entry data.
+    std::string contents(Blob::fromFile(path).string_view());
+    contents.back() ^= 1;
+    {
+        FileOutputStream output(path);
+        output.write(contents.data(), contents.size());
+    }
+
+    EXPECT_EQ(SnapshotReader::open(path, 1), nullptr);
+    EXPECT_EQ(SnapshotReader::open(path + ".missing", 1), nullptr);
+
+    std::filesystem::remove(path);
+}
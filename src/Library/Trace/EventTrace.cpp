@@ -2,6 +2,8 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "Library/Serialization/EnumSerialization.h"
 #include "Library/Json/Json.h"
@@ -11,6 +13,8 @@
 #include "Utility/Streams/FileInputStream.h"
 #include "Utility/Streams/FileOutputStream.h"
 
+#include "Library/Trace/Internal/BinaryEventTrace.h"
+#include "Library/Trace/Internal/EventTraceCommon.h"
 #include "PaintEvent.h"
 
 MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(Pointi, (
@@ -110,39 +114,6 @@ MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(PaintEvent, (
     (randomState, "randomState")
 ))
 
-template<class Callable>
-inline void DispatchByEventType(PlatformEventType type, Callable &&callable) {
-    switch (type) {
-    case EVENT_KEY_PRESS:
-    case EVENT_KEY_RELEASE:
-        callable(static_cast<PlatformKeyEvent *>(nullptr));
-        break;
-    case EVENT_MOUSE_BUTTON_PRESS:
-    case EVENT_MOUSE_BUTTON_RELEASE:
-    case EVENT_MOUSE_MOVE:
-        callable(static_cast<PlatformMouseEvent *>(nullptr));
-        break;
-    case EVENT_MOUSE_WHEEL:
-        callable(static_cast<PlatformWheelEvent *>(nullptr));
-        break;
-    case EVENT_WINDOW_MOVE:
-        callable(static_cast<PlatformMoveEvent *>(nullptr));
-        break;
-    case EVENT_WINDOW_RESIZE:
-        callable(static_cast<PlatformResizeEvent *>(nullptr));
-        break;
-    case EVENT_WINDOW_ACTIVATE:
-    case EVENT_WINDOW_DEACTIVATE:
-    case EVENT_WINDOW_CLOSE_REQUEST:
-        callable(static_cast<PlatformWindowEvent *>(nullptr));
-    case EVENT_PAINT:
-        callable(static_cast<PaintEvent *>(nullptr));
-        break;
-    default:
-        return; // No gamepad events.
-    }
-}
-
 static void to_json(Json &json, const std::unique_ptr<PlatformEvent> &value) {
     if (!value) {
         json = nullptr;
@@ -195,6 +166,18 @@ MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(EventTrace, (
 void EventTrace::saveToFile(std::string_view path, const EventTrace &trace) {
     FileOutputStream output(path);
 
+    if (isBinaryEventTracePath(path)) {
+        Json header;
+        to_json(header, trace.header);
+
+        BinaryEventTraceWriter writer(&output, header.dump());
+        for (const std::unique_ptr<PlatformEvent> &event : trace.events)
+            writer.write(event.get());
+        writer.finish();
+        output.close();
+        return;
+    }
+
     // TODO(captainurist): well, nlohmann json is retarded in that it chokes if we throw exceptions inside
     // to_json calls for individual elements. Fix upstream?
     // Note: there is an example in tests to reproduce.
@@ -204,20 +187,12 @@ void EventTrace::saveToFile(std::string_view path, const EventTrace &trace) {
 }
 
 EventTrace EventTrace::loadFromFile(std::string_view path, PlatformWindow *window) {
-    FileInputStream input(path);
-    Json json = Json::parse(input.handle());
+    EventTraceReader reader(path, window);
 
     EventTrace result;
-    from_json(json, result);
-
-    for (std::unique_ptr<PlatformEvent> &event : result.events) {
-        DispatchByEventType(event->type, [&]<class T>(T *) {
-            if constexpr (std::is_base_of_v<PlatformWindowEvent, T>) {
-                static_cast<PlatformWindowEvent *>(event.get())->window = window;
-            }
-        });
-    }
-
+    result.header = reader.header();
+    while (std::unique_ptr<PlatformEvent> event = reader.next())
+        result.events.push_back(std::move(event));
     return result;
 }
 
@@ -238,3 +213,39 @@ std::unique_ptr<PlatformEvent> EventTrace::cloneEvent(const PlatformEvent *event
 
     return result;
 }
+
+EventTraceReader::EventTraceReader(std::string_view path, PlatformWindow *window) : _window(window) {
+    if (isBinaryEventTracePath(path)) {
+        _binaryReader = std::make_unique<BinaryEventTraceReader>(path);
+        from_json(Json::parse(_binaryReader->headerJson()), _header);
+    } else {
+        FileInputStream input(path);
+        Json json = Json::parse(input.handle());
+
+        EventTrace trace;
+        from_json(json, trace);
+        _header = std::move(trace.header);
+        _events = std::move(trace.events);
+    }
+}
+
+EventTraceReader::~EventTraceReader() = default;
+
+std::unique_ptr<PlatformEvent> EventTraceReader::next() {
+    std::unique_ptr<PlatformEvent> result;
+    if (_binaryReader) {
+        result = _binaryReader->next();
+    } else if (_nextEvent < _events.size()) {
+        result = std::move(_events[_nextEvent++]);
+    }
+
+    if (result) {
+        DispatchByEventType(result->type, [&]<class T>(T *) {
+            if constexpr (std::is_base_of_v<PlatformWindowEvent, T>) {
+                static_cast<PlatformWindowEvent *>(result.get())->window = _window;
+            }
+        });
+    }
+
+    return result;
+}
@@ -29,6 +29,16 @@ struct EventTraceHeader {
     // TODO(captainurist): std::string saveFileChecksum;
 };
 
+class BinaryEventTraceReader;
+
+/**
+ * Event trace, a recording of all the platform events that the engine has received, together with a header that
+ * describes the state of the game at the start & at the end of the trace.
+ *
+ * Traces can be saved in two formats, which one is used is decided based on file extension:
+ * - `.oetrace` files use a compact binary format, see `BinaryEventTraceWriter`.
+ * - All other files are saved as json.
+ */
 struct EventTrace {
     static void saveToFile(std::string_view path, const EventTrace &trace);
     static EventTrace loadFromFile(std::string_view path, PlatformWindow *window);
@@ -39,3 +49,35 @@ struct EventTrace {
     EventTraceHeader header;
     std::vector<std::unique_ptr<PlatformEvent>> events;
 };
+
+/**
+ * Streaming trace reader. For binary traces, events are decoded on the fly as they are requested, so playback can
+ * start right after the header is read. Json traces are parsed in full in the constructor.
+ */
+class EventTraceReader {
+ public:
+    /**
+     * @param path                      Path to the trace file.
+     * @param window                    Window to set for all window events in the trace.
+     * @throws Exception                If the trace couldn't be opened or parsed.
+     */
+    EventTraceReader(std::string_view path, PlatformWindow *window);
+    ~EventTraceReader();
+
+    [[nodiscard]] const EventTraceHeader &header() const {
+        return _header;
+    }
+
+    /**
+     * @return                          Next event in the trace, or `nullptr` if the end of the trace was reached.
+     * @throws Exception                If the trace is corrupted.
+     */
+    std::unique_ptr<PlatformEvent> next();
+
+ private:
+    PlatformWindow *_window = nullptr;
+    EventTraceHeader _header;
+    std::unique_ptr<BinaryEventTraceReader> _binaryReader; // Null for json traces.
+    std::vector<std::unique_ptr<PlatformEvent>> _events; // Events of a json trace.
+    size_t _nextEvent = 0;
+};
@@ -0,0 +1,379 @@
+#include "BinaryEventTrace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "Library/Compression/Compression.h"
+#include "Library/Serialization/Serialization.h"
+
+#include "Io/Key.h" // TODO(captainurist): doesn't belong here
+
+#include "Utility/Streams/OutputStream.h"
+#include "Utility/Exception.h"
+
+#include "Library/Trace/Internal/EventTraceCommon.h"
+
+static constexpr char BINARY_TRACE_MAGIC[8] = {'O', 'E', 'T', 'R', 'A', 'C', 'E', '\0'};
+static constexpr uint64_t BINARY_TRACE_VERSION = 1;
+static constexpr size_t BINARY_TRACE_CHUNK_SIZE = 64 * 1024;
+// Writer flushes a chunk as soon as it reaches BINARY_TRACE_CHUNK_SIZE, so chunks can only overshoot it by a single
+// record. Anything larger than this is a corrupted size.
+static constexpr size_t BINARY_TRACE_MAX_CHUNK_SIZE = 2 * BINARY_TRACE_CHUNK_SIZE;
+
+// Record tags in the event stream. Tags starting from TAG_EVENT are events, `tag - TAG_EVENT` is the interned type id.
+static constexpr uint64_t TAG_DEFINE_TYPE = 0;
+static constexpr uint64_t TAG_DEFINE_KEY = 1;
+static constexpr uint64_t TAG_EVENT = 2;
+
+//
+// Encoding.
+//
+
+static void writeVarint(std::string *dst, uint64_t value) {
+    while (value >= 0x80) {
+        dst->push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    dst->push_back(static_cast<char>(value));
+}
+
+static void writeSigned(std::string *dst, int64_t value) {
+    writeVarint(dst, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63)); // Zigzag.
+}
+
+static void writeString(std::string *dst, std::string_view value) {
+    writeVarint(dst, value.size());
+    dst->append(value);
+}
+
+template<class T>
+static size_t internValue(std::vector<T> *table, T value, std::string *dst, uint64_t defineTag) {
+    auto pos = std::find(table->begin(), table->end(), value);
+    if (pos != table->end())
+        return pos - table->begin();
+
+    writeVarint(dst, defineTag);
+    writeString(dst, toString(value));
+    table->push_back(value);
+    return table->size() - 1;
+}
+
+BinaryEventTraceWriter::BinaryEventTraceWriter(OutputStream *output, std::string_view headerJson) : _output(output) {
+    std::string preamble(BINARY_TRACE_MAGIC, sizeof(BINARY_TRACE_MAGIC));
+    writeVarint(&preamble, BINARY_TRACE_VERSION);
+    writeString(&preamble, headerJson);
+    _output->write(preamble);
+}
+
+void BinaryEventTraceWriter::write(const PlatformEvent *event) {
+    // Check before anything is written out, a type tag w/o a payload would make the whole trace unreadable.
+    if (!event)
+        throw Exception("Null events can't be written to a binary trace");
+    bool supported = false;
+    DispatchByEventType(event->type, [&](auto) { supported = true; });
+    if (!supported)
+        throw Exception("Events of type {} can't be written to a binary trace", std::to_underlying(event->type));
+
+    size_t typeId = internValue(&_types, event->type, &_chunk, TAG_DEFINE_TYPE);
+
+    // Keys have to be defined before the event record that references them.
+    size_t keyId = 0;
+    if (event->type == EVENT_KEY_PRESS || event->type == EVENT_KEY_RELEASE)
+        keyId = internValue(&_keys, static_cast<const PlatformKeyEvent *>(event)->key, &_chunk, TAG_DEFINE_KEY);
+
+    writeVarint(&_chunk, TAG_EVENT + typeId);
+
+    DispatchByEventType(event->type, [&]<class T>(T *) {
+        const T *e = static_cast<const T *>(event);
+        if constexpr (std::is_same_v<T, PlatformKeyEvent>) {
+            writeVarint(&_chunk, keyId);
+            writeVarint(&_chunk, static_cast<PlatformModifiers::underlying_type>(e->mods));
+            writeVarint(&_chunk, e->isAutoRepeat);
+        } else if constexpr (std::is_same_v<T, PlatformMouseEvent>) {
+            writeVarint(&_chunk, std::to_underlying(e->button));
+            writeVarint(&_chunk, static_cast<PlatformMouseButtons::underlying_type>(e->buttons));
+            writeSigned(&_chunk, e->pos.x);
+            writeSigned(&_chunk, e->pos.y);
+            writeVarint(&_chunk, e->isDoubleClick);
+        } else if constexpr (std::is_same_v<T, PlatformWheelEvent>) {
+            writeSigned(&_chunk, e->angleDelta.x);
+            writeSigned(&_chunk, e->angleDelta.y);
+            writeVarint(&_chunk, e->inverted);
+        } else if constexpr (std::is_same_v<T, PlatformMoveEvent>) {
+            writeSigned(&_chunk, e->pos.x);
+            writeSigned(&_chunk, e->pos.y);
+        } else if constexpr (std::is_same_v<T, PlatformResizeEvent>) {
+            writeSigned(&_chunk, e->size.w);
+            writeSigned(&_chunk, e->size.h);
+        } else if constexpr (std::is_same_v<T, PaintEvent>) {
+            writeSigned(&_chunk, e->tickCount - _lastTickCount);
+            writeSigned(&_chunk, e->randomState);
+            _lastTickCount = e->tickCount;
+        }
+    });
+
+    if (_chunk.size() >= BINARY_TRACE_CHUNK_SIZE)
+        flushChunk();
+}
+
+void BinaryEventTraceWriter::finish() {
+    flushChunk();
+
+    std::string end;
+    writeVarint(&end, 0);
+    _output->write(end);
+}
+
+void BinaryEventTraceWriter::flushChunk() {
+    if (_chunk.empty())
+        return;
+
+    Blob compressed = zlib::Compress(Blob::view(_chunk.data(), _chunk.size()));
+    bool useCompressed = compressed.size() < _chunk.size();
+
+    std::string chunkHeader;
+    writeVarint(&chunkHeader, _chunk.size());
+    writeVarint(&chunkHeader, useCompressed ? compressed.size() : 0);
+    _output->write(chunkHeader);
+    if (useCompressed) {
+        _output->write(compressed.data(), compressed.size());
+    } else {
+        _output->write(_chunk);
+    }
+
+    _chunk.clear();
+}
+
+//
+// Decoding.
+//
+
+namespace {
+class ChunkCursor {
+ public:
+    ChunkCursor(const std::string &data, size_t *pos) : _data(data), _pos(pos) {}
+
+    [[nodiscard]] bool atEnd() const {
+        return *_pos >= _data.size();
+    }
+
+    bool readVarint(uint64_t *value) {
+        uint64_t result = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (atEnd())
+                return false;
+            uint8_t byte = static_cast<uint8_t>(_data[(*_pos)++]);
+            result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                *value = result;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<class T>
+    bool readSigned(T *value) {
+        uint64_t raw;
+        if (!readVarint(&raw))
+            return false;
+        *value = static_cast<T>(static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1));
+        return true;
+    }
+
+    template<class T>
+    bool readUnsigned(T *value) {
+        uint64_t raw;
+        if (!readVarint(&raw))
+            return false;
+        *value = static_cast<T>(raw);
+        return true;
+    }
+
+    bool readString(std::string_view *value) {
+        uint64_t size;
+        if (!readVarint(&size) || _data.size() - *_pos < size)
+            return false;
+        *value = std::string_view(_data).substr(*_pos, size);
+        *_pos += size;
+        return true;
+    }
+
+ private:
+    const std::string &_data;
+    size_t *_pos;
+};
+} // namespace
+
+static bool readStreamVarint(InputStream *input, uint64_t *value, bool *eof = nullptr) {
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte;
+        if (input->read(&byte, 1) != 1) {
+            if (eof)
+                *eof = shift == 0;
+            return false;
+        }
+        result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+BinaryEventTraceReader::BinaryEventTraceReader(std::string_view path) : _path(path), _input(path) {
+    std::error_code ec;
+    _fileSize = std::filesystem::file_size(_path, ec);
+    if (ec)
+        throw Exception("Could not get the size of binary trace '{}': {}", _path, ec.message());
+
+    char magic[sizeof(BINARY_TRACE_MAGIC)];
+    if (_input.read(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, BINARY_TRACE_MAGIC, sizeof(magic)) != 0)
+        throw Exception("File '{}' is not a binary trace", _path);
+
+    uint64_t version;
+    if (!readStreamVarint(&_input, &version))
+        throwCorrupted();
+    if (version != BINARY_TRACE_VERSION)
+        throw Exception("Binary trace '{}' has unsupported version {}, expected {}", _path, version, BINARY_TRACE_VERSION);
+
+    uint64_t headerSize;
+    if (!readStreamVarint(&_input, &headerSize) || headerSize > remainingSize())
+        throwCorrupted();
+    _headerJson.resize(headerSize);
+    _input.readOrFail(_headerJson.data(), headerSize);
+}
+
+std::unique_ptr<PlatformEvent> BinaryEventTraceReader::next() {
+    while (true) {
+        if (_chunkPos >= _chunk.size() && !readChunk())
+            return nullptr;
+
+        ChunkCursor cursor(_chunk, &_chunkPos);
+
+        uint64_t tag;
+        if (!cursor.readVarint(&tag))
+            throwCorrupted();
+
+        if (tag == TAG_DEFINE_TYPE || tag == TAG_DEFINE_KEY) {
+            std::string_view name;
+            if (!cursor.readString(&name))
+                throwCorrupted();
+            if (tag == TAG_DEFINE_TYPE) {
+                _types.push_back(fromString<PlatformEventType>(name));
+            } else {
+                _keys.push_back(fromString<PlatformKey>(name));
+            }
+            continue;
+        }
+
+        size_t typeId = tag - TAG_EVENT;
+        if (typeId >= _types.size())
+            throwCorrupted();
+        PlatformEventType type = _types[typeId];
+
+        std::unique_ptr<PlatformEvent> result;
+        bool ok = true;
+        DispatchByEventType(type, [&]<class T>(T *) {
+            std::unique_ptr<T> e = std::make_unique<T>();
+            e->type = type;
+
+            if constexpr (std::is_same_v<T, PlatformKeyEvent>) {
+                size_t keyId = 0;
+                PlatformModifiers::underlying_type mods = 0;
+                ok = cursor.readUnsigned(&keyId) && keyId < _keys.size() &&
+                     cursor.readUnsigned(&mods) && cursor.readUnsigned(&e->isAutoRepeat);
+                if (ok) {
+                    e->key = _keys[keyId];
+                    e->mods = PlatformModifiers(mods);
+                }
+            } else if constexpr (std::is_same_v<T, PlatformMouseEvent>) {
+                std::underlying_type_t<PlatformMouseButton> button = 0;
+                PlatformMouseButtons::underlying_type buttons = 0;
+                ok = cursor.readUnsigned(&button) && cursor.readUnsigned(&buttons) &&
+                     cursor.readSigned(&e->pos.x) && cursor.readSigned(&e->pos.y) &&
+                     cursor.readUnsigned(&e->isDoubleClick);
+                if (ok) {
+                    e->button = static_cast<PlatformMouseButton>(button);
+                    e->buttons = PlatformMouseButtons(buttons);
+                }
+            } else if constexpr (std::is_same_v<T, PlatformWheelEvent>) {
+                ok = cursor.readSigned(&e->angleDelta.x) && cursor.readSigned(&e->angleDelta.y) &&
+                     cursor.readUnsigned(&e->inverted);
+            } else if constexpr (std::is_same_v<T, PlatformMoveEvent>) {
+                ok = cursor.readSigned(&e->pos.x) && cursor.readSigned(&e->pos.y);
+            } else if constexpr (std::is_same_v<T, PlatformResizeEvent>) {
+                ok = cursor.readSigned(&e->size.w) && cursor.readSigned(&e->size.h);
+            } else if constexpr (std::is_same_v<T, PaintEvent>) {
+                int64_t tickDelta = 0;
+                ok = cursor.readSigned(&tickDelta) && cursor.readSigned(&e->randomState);
+                if (ok) {
+                    e->tickCount = _lastTickCount + tickDelta;
+                    _lastTickCount = e->tickCount;
+                }
+            }
+
+            result = std::move(e);
+        });
+
+        if (!ok || !result)
+            throwCorrupted();
+        return result;
+    }
+}
+
+bool BinaryEventTraceReader::readChunk() {
+    if (_finished)
+        return false;
+
+    uint64_t rawSize, storedSize;
+    if (!readStreamVarint(&_input, &rawSize))
+        throwCorrupted();
+    if (rawSize == 0) {
+        _finished = true;
+        return false;
+    }
+    if (!readStreamVarint(&_input, &storedSize))
+        throwCorrupted();
+
+    // Sizes are checked before allocating anything, so that a corrupted size doesn't turn into a huge allocation.
+    // Chunks are only stored compressed if that makes them smaller.
+    if (rawSize > BINARY_TRACE_MAX_CHUNK_SIZE || storedSize >= rawSize || (storedSize ? storedSize : rawSize) > remainingSize())
+        throwCorrupted();
+
+    if (storedSize == 0) {
+        _chunk.resize(rawSize);
+        _input.readOrFail(_chunk.data(), rawSize);
+    } else {
+        std::string compressed(storedSize, '\0');
+        _input.readOrFail(compressed.data(), storedSize);
+        Blob uncompressed = zlib::Uncompress(Blob::view(compressed.data(), compressed.size()), rawSize);
+        if (uncompressed.size() != rawSize)
+            throwCorrupted();
+        _chunk.assign(static_cast<const char *>(uncompressed.data()), uncompressed.size());
+    }
+    _chunkPos = 0;
+    return true;
+}
+
+size_t BinaryEventTraceReader::remainingSize() {
+    long pos = ftell(_input.handle());
+    if (pos < 0 || static_cast<uint64_t>(pos) > _fileSize)
+        return 0;
+    return _fileSize - pos;
+}
+
+void BinaryEventTraceReader::throwCorrupted() const {
+    throw Exception("Binary trace '{}' is corrupted", _path);
+}
+
+bool isBinaryEventTracePath(std::string_view path) {
+    return path.ends_with(".oetrace");
+}
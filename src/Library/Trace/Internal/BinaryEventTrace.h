@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Platform/PlatformEnums.h"
+
+#include "Utility/Streams/FileInputStream.h"
+
+class OutputStream;
+class PlatformEvent;
+
+/**
+ * Binary trace format.
+ *
+ * File starts with a preamble - magic, format version and trace header as a json string. After that goes the event
+ * stream, split into chunks, each chunk is zlib-compressed if that actually makes it smaller. Chunks are decoded one
+ * at a time, so the reader doesn't need to load the whole file to start returning events.
+ *
+ * Inside the event stream, event types and keys are interned - the first time a type or a key is used, it's written
+ * out as a string, and afterwards it's referenced by index. This keeps the format independent of enum values.
+ * Paint event tick counts are delta-encoded, and all integers are written as LEB128 varints.
+ */
+class BinaryEventTraceWriter {
+ public:
+    /**
+     * @param output                    Output stream to write into. Must outlive this writer.
+     * @param headerJson                Serialized trace header.
+     */
+    BinaryEventTraceWriter(OutputStream *output, std::string_view headerJson);
+
+    /**
+     * @param event                     Event to write.
+     * @throws Exception                If the event is null, or its type is not supported in traces, see
+     *                                  `EventTrace::isTraceable`.
+     */
+    void write(const PlatformEvent *event);
+
+    /**
+     * Flushes the last chunk and writes out the end of stream marker. Must be called once all events were written.
+     */
+    void finish();
+
+ private:
+    void flushChunk();
+
+    OutputStream *_output = nullptr;
+    std::string _chunk;
+    std::vector<PlatformEventType> _types; // Interned event types, index is the id in the stream.
+    std::vector<PlatformKey> _keys; // Interned keys.
+    int64_t _lastTickCount = 0;
+};
+
+class BinaryEventTraceReader {
+ public:
+    /**
+     * Opens a binary trace & reads its preamble.
+     *
+     * @param path                      Path to the trace file.
+     * @throws Exception                If the file couldn't be opened, or is not a binary trace.
+     */
+    explicit BinaryEventTraceReader(std::string_view path);
+
+    [[nodiscard]] const std::string &headerJson() const {
+        return _headerJson;
+    }
+
+    /**
+     * @return                          Next event in the trace, or `nullptr` if the end of the trace was reached.
+     * @throws Exception                If the trace is corrupted.
+     */
+    std::unique_ptr<PlatformEvent> next();
+
+ private:
+    bool readChunk();
+    size_t remainingSize(); // Number of bytes left in the file.
+    [[noreturn]] void throwCorrupted() const;
+
+    std::string _path;
+    FileInputStream _input;
+    uint64_t _fileSize = 0;
+    std::string _headerJson;
+    std::string _chunk;
+    size_t _chunkPos = 0;
+    bool _finished = false;
+    std::vector<PlatformEventType> _types;
+    std::vector<PlatformKey> _keys;
+    int64_t _lastTickCount = 0;
+};
+
+/**
+ * @param path                          Path to a trace file.
+ * @return                              Whether the binary format should be used for this trace file, which is decided
+ *                                      based on file extension.
+ */
+bool isBinaryEventTracePath(std::string_view path);
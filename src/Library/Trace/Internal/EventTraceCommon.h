@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Library/Serialization/SerializationFwd.h"
+
+#include "Platform/PlatformEvents.h"
+
+#include "Library/Trace/PaintEvent.h"
+
+// Defined in EventTrace.cpp.
+MM_DECLARE_SERIALIZATION_FUNCTIONS(PlatformEventType)
+
+/**
+ * Invokes the provided callable with a null pointer of the event class that's used for events of the provided type.
+ * Callable is not invoked for event types that are not supported in traces.
+ *
+ * @param type                          Event type.
+ * @param callable                      Callable to invoke, e.g. `[&]<class T>(T *) { ... }`.
+ */
+template<class Callable>
+inline void DispatchByEventType(PlatformEventType type, Callable &&callable) {
+    switch (type) {
+    case EVENT_KEY_PRESS:
+    case EVENT_KEY_RELEASE:
+        callable(static_cast<PlatformKeyEvent *>(nullptr));
+        break;
+    case EVENT_MOUSE_BUTTON_PRESS:
+    case EVENT_MOUSE_BUTTON_RELEASE:
+    case EVENT_MOUSE_MOVE:
+        callable(static_cast<PlatformMouseEvent *>(nullptr));
+        break;
+    case EVENT_MOUSE_WHEEL:
+        callable(static_cast<PlatformWheelEvent *>(nullptr));
+        break;
+    case EVENT_WINDOW_MOVE:
+        callable(static_cast<PlatformMoveEvent *>(nullptr));
+        break;
+    case EVENT_WINDOW_RESIZE:
+        callable(static_cast<PlatformResizeEvent *>(nullptr));
+        break;
+    case EVENT_WINDOW_ACTIVATE:
+    case EVENT_WINDOW_DEACTIVATE:
+    case EVENT_WINDOW_CLOSE_REQUEST:
+        callable(static_cast<PlatformWindowEvent *>(nullptr));
+        break;
+    case EVENT_PAINT:
+        callable(static_cast<PaintEvent *>(nullptr));
+        break;
+    default:
+        return; // No gamepad events.
+    }
+}
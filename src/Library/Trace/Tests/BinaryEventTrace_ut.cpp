@@ -0,0 +1,326 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Trace/Internal/BinaryEventTrace.h"
+#include "Library/Trace/PaintEvent.h"
+
+#include "Utility/Exception.h"
+#include "Utility/Streams/FileOutputStream.h"
+
+struct ChunkInfo {
+    uint64_t rawSize = 0;
+    uint64_t storedSize = 0; // Zero for uncompressed chunks.
+};
+
+static std::string tracePath(const char *name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static std::unique_ptr<PaintEvent> paintEvent(int64_t tickCount, int randomState) {
+    std::unique_ptr<PaintEvent> result = std::make_unique<PaintEvent>();
+    result->type = EVENT_PAINT;
+    result->tickCount = tickCount;
+    result->randomState = randomState;
+    return result;
+}
+
+static void writeTrace(const std::string &path, const std::vector<std::unique_ptr<PlatformEvent>> &events) {
+    FileOutputStream output(path);
+    BinaryEventTraceWriter writer(&output, "{\"a\":1}");
+    for (const std::unique_ptr<PlatformEvent> &event : events)
+        writer.write(event.get());
+    writer.finish();
+    output.close();
+}
+
+static std::vector<std::unique_ptr<PlatformEvent>> readTrace(const std::string &path) {
+    BinaryEventTraceReader reader(path);
+    std::vector<std::unique_ptr<PlatformEvent>> result;
+    while (std::unique_ptr<PlatformEvent> event = reader.next())
+        result.push_back(std::move(event));
+    return result;
+}
+
+static std::string readFile(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string &path, const std::string &data) {
+    std::ofstream file(path, std::ios::binary);
+    file << data;
+}
+
+static uint64_t readVarint(const std::string &data, size_t *pos) {
+    uint64_t result = 0;
+    for (int shift = 0; *pos < data.size(); shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(data[(*pos)++]);
+        result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            break;
+    }
+    return result;
+}
+
+static void appendVarint(std::string *data, uint64_t value) {
+    while (value >= 0x80) {
+        data->push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    data->push_back(static_cast<char>(value));
+}
+
+static size_t preambleSize(const std::string &data) {
+    size_t pos = 8; // Magic.
+    readVarint(data, &pos); // Version.
+    pos += readVarint(data, &pos); // Header.
+    return pos;
+}
+
+static std::vector<ChunkInfo> readChunks(const std::string &path) {
+    std::string data = readFile(path);
+    size_t pos = preambleSize(data);
+
+    std::vector<ChunkInfo> result;
+    while (true) {
+        ChunkInfo chunk;
+        chunk.rawSize = readVarint(data, &pos);
+        if (chunk.rawSize == 0)
+            break;
+        chunk.storedSize = readVarint(data, &pos);
+        pos += chunk.storedSize ? chunk.storedSize : chunk.rawSize;
+        result.push_back(chunk);
+    }
+    return result;
+}
+
+UNIT_TEST(BinaryEventTrace, RoundTrip) {
+    std::string path = tracePath("binary_event_trace_ut_round_trip.oetrace");
+
+    std::vector<std::unique_ptr<PlatformEvent>> events;
+
+    std::unique_ptr<PlatformKeyEvent> key = std::make_unique<PlatformKeyEvent>();
+    key->type = EVENT_KEY_PRESS;
+    key->key = PlatformKey::Escape;
+    key->mods = MOD_SHIFT | MOD_CTRL;
+    key->isAutoRepeat = true;
+    events.push_back(std::move(key));
+
+    std::unique_ptr<PlatformMouseEvent> mouse = std::make_unique<PlatformMouseEvent>();
+    mouse->type = EVENT_MOUSE_BUTTON_PRESS;
+    mouse->button = BUTTON_LEFT;
+    mouse->buttons = BUTTON_LEFT | BUTTON_RIGHT;
+    mouse->pos = Pointi(-10, 480);
+    mouse->isDoubleClick = true;
+    events.push_back(std::move(mouse));
+
+    std::unique_ptr<PlatformWheelEvent> wheel = std::make_unique<PlatformWheelEvent>();
+    wheel->type = EVENT_MOUSE_WHEEL;
+    wheel->angleDelta = Pointi(0, -120);
+    wheel->inverted = true;
+    events.push_back(std::move(wheel));
+
+    std::unique_ptr<PlatformResizeEvent> resize = std::make_unique<PlatformResizeEvent>();
+    resize->type = EVENT_WINDOW_RESIZE;
+    resize->size = Sizei(640, 480);
+    events.push_back(std::move(resize));
+
+    std::unique_ptr<PlatformWindowEvent> activate = std::make_unique<PlatformWindowEvent>();
+    activate->type = EVENT_WINDOW_ACTIVATE;
+    events.push_back(std::move(activate));
+
+    events.push_back(paintEvent(1000, 7));
+    events.push_back(paintEvent(900, -1)); // Negative tick delta.
+
+    writeTrace(path, events);
+
+    BinaryEventTraceReader reader(path);
+    EXPECT_EQ(reader.headerJson(), "{\"a\":1}");
+
+    std::vector<std::unique_ptr<PlatformEvent>> result = readTrace(path);
+    ASSERT_EQ(result.size(), events.size());
+    for (size_t i = 0; i < events.size(); i++)
+        EXPECT_EQ(result[i]->type, events[i]->type);
+
+    const PlatformKeyEvent *resultKey = static_cast<const PlatformKeyEvent *>(result[0].get());
+    EXPECT_EQ(resultKey->key, PlatformKey::Escape);
+    EXPECT_EQ(resultKey->mods, MOD_SHIFT | MOD_CTRL);
+    EXPECT_TRUE(resultKey->isAutoRepeat);
+
+    const PlatformMouseEvent *resultMouse = static_cast<const PlatformMouseEvent *>(result[1].get());
+    EXPECT_EQ(resultMouse->button, BUTTON_LEFT);
+    EXPECT_EQ(resultMouse->buttons, BUTTON_LEFT | BUTTON_RIGHT);
+    EXPECT_EQ(resultMouse->pos.x, -10);
+    EXPECT_EQ(resultMouse->pos.y, 480);
+    EXPECT_TRUE(resultMouse->isDoubleClick);
+
+    const PlatformWheelEvent *resultWheel = static_cast<const PlatformWheelEvent *>(result[2].get());
+    EXPECT_EQ(resultWheel->angleDelta.x, 0);
+    EXPECT_EQ(resultWheel->angleDelta.y, -120);
+    EXPECT_TRUE(resultWheel->inverted);
+
+    EXPECT_EQ(static_cast<const PlatformResizeEvent *>(result[3].get())->size, Sizei(640, 480));
+
+    const PaintEvent *resultPaint = static_cast<const PaintEvent *>(result[6].get());
+    EXPECT_EQ(resultPaint->tickCount, 900);
+    EXPECT_EQ(resultPaint->randomState, -1);
+
+    std::filesystem::remove(path);
+}
+
+UNIT_TEST(BinaryEventTrace, Chunks) {
+    std::string path = tracePath("binary_event_trace_ut_chunks.oetrace");
+
+    // A single small event doesn't compress.
+    std::vector<std::unique_ptr<PlatformEvent>> events;
+    events.push_back(paintEvent(16, 3));
+    writeTrace(path, events);
+
+    std::vector<ChunkInfo> chunks = readChunks(path);
+    ASSERT_EQ(chunks.size(), 1);
+    EXPECT_EQ(chunks[0].storedSize, 0);
+    EXPECT_EQ(readTrace(path).size(), 1);
+
+    // Lots of similar events compress well, and span several chunks.
+    events.clear();
+    for (int i = 0; i < 100000; i++)
+        events.push_back(paintEvent(i * 16, i % 1024));
+    writeTrace(path, events);
+
+    chunks = readChunks(path);
+    ASSERT_GT(chunks.size(), 1);
+    for (const ChunkInfo &chunk : chunks) {
+        EXPECT_NE(chunk.storedSize, 0);
+        EXPECT_LT(chunk.storedSize, chunk.rawSize);
+    }
+
+    std::vector<std::unique_ptr<PlatformEvent>> result = readTrace(path);
+    ASSERT_EQ(result.size(), events.size());
+    for (size_t i = 0; i < events.size(); i++) {
+        const PaintEvent *expected = static_cast<const PaintEvent *>(events[i].get());
+        const PaintEvent *actual = static_cast<const PaintEvent *>(result[i].get());
+        ASSERT_EQ(actual->tickCount, expected->tickCount);
+        ASSERT_EQ(actual->randomState, expected->randomState);
+    }
+
+    std::filesystem::remove(path);
+}
+
+UNIT_TEST(BinaryEventTrace, UnsupportedEvents) {
+    std::string path = tracePath("binary_event_trace_ut_unsupported.oetrace");
+
+    FileOutputStream output(path);
+    BinaryEventTraceWriter writer(&output, "{}");
+    EXPECT_ANY_THROW(writer.write(nullptr));
+
+    PlatformGamepadEvent gamepad;
+    gamepad.type = EVENT_GAMEPAD_CONNECTED;
+    EXPECT_ANY_THROW(writer.write(&gamepad));
+
+    // Rejected events leave no traces in the output.
+    writer.write(paintEvent(1, 1).get());
+    writer.finish();
+    output.close();
+    EXPECT_EQ(readTrace(path).size(), 1);
+
+    std::filesystem::remove(path);
+}
+
+UNIT_TEST(BinaryEventTrace, Corrupted) {
+    std::string path = tracePath("binary_event_trace_ut_corrupted.oetrace");
+    std::string brokenPath = tracePath("binary_event_trace_ut_corrupted_broken.oetrace");
+
+    std::vector<std::unique_ptr<PlatformEvent>> events;
+    for (int i = 0; i < 1000; i++)
+        events.push_back(paintEvent(i * 16, 0));
+    writeTrace(path, events);
+    std::string data = readFile(path);
+
+    // Not a trace.
+    writeFile(brokenPath, "not a trace at all");
+    EXPECT_ANY_THROW(BinaryEventTraceReader reader(brokenPath));
+
+    // Truncated in the middle of the header.
+    writeFile(brokenPath, data.substr(0, 12));
+    EXPECT_ANY_THROW(BinaryEventTraceReader reader(brokenPath));
+
+    // Truncated in the middle of the event stream.
+    writeFile(brokenPath, data.substr(0, data.size() / 2));
+    EXPECT_ANY_THROW(readTrace(brokenPath));
+
+    // Missing end of stream marker.
+    writeFile(brokenPath, data.substr(0, data.size() - 1));
+    EXPECT_ANY_THROW(readTrace(brokenPath));
+
+    // Garbage in the compressed data.
+    std::string garbage = data;
+    for (size_t i = data.size() / 2; i < data.size() / 2 + 16; i++)
+        garbage[i] = static_cast<char>(garbage[i] ^ 0x5A);
+    writeFile(brokenPath, garbage);
+    EXPECT_ANY_THROW(readTrace(brokenPath));
+
+    // Event referencing a type that was never defined.
+    std::string undefinedType = data.substr(0, preambleSize(data));
+    undefinedType += std::string("\x01\x00\x05", 3); // One byte chunk, uncompressed, event with type id 3.
+    undefinedType += '\0';
+    writeFile(brokenPath, undefinedType);
+    EXPECT_ANY_THROW(readTrace(brokenPath));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(brokenPath);
+}
+
+UNIT_TEST(BinaryEventTrace, CorruptedSizes) {
+    std::string path = tracePath("binary_event_trace_ut_corrupted_sizes.oetrace");
+    std::string brokenPath = tracePath("binary_event_trace_ut_corrupted_sizes_broken.oetrace");
+
+    std::vector<std::unique_ptr<PlatformEvent>> events;
+    for (int i = 0; i < 1000; i++)
+        events.push_back(paintEvent(i * 16, 0));
+    writeTrace(path, events);
+    std::string data = readFile(path);
+    std::string magic = data.substr(0, 9); // Magic & version.
+    std::string preamble = data.substr(0, preambleSize(data));
+
+    // Sizes that claim more data than there is in the file, or more than a chunk can hold, should be reported as
+    // corruption, and not end up in a huge allocation.
+    for (uint64_t size : {uint64_t(1) << 20, uint64_t(1) << 40, ~uint64_t(0) >> 1}) {
+        std::string broken = magic;
+        appendVarint(&broken, size); // Header size.
+        broken += "{}";
+        writeFile(brokenPath, broken);
+        EXPECT_THROW(BinaryEventTraceReader reader(brokenPath), Exception) << "Header size " << size;
+
+        broken = preamble;
+        appendVarint(&broken, size); // Raw size.
+        appendVarint(&broken, 0); // Uncompressed.
+        broken += std::string(16, '\0');
+        writeFile(brokenPath, broken);
+        EXPECT_THROW(readTrace(brokenPath), Exception) << "Raw size " << size;
+
+        broken = preamble;
+        appendVarint(&broken, 1000); // Raw size.
+        appendVarint(&broken, size); // Stored size.
+        broken += std::string(16, '\0');
+        writeFile(brokenPath, broken);
+        EXPECT_THROW(readTrace(brokenPath), Exception) << "Stored size " << size;
+    }
+
+    // Uncompressed chunk that's larger than the rest of the file.
+    std::string broken = preamble;
+    appendVarint(&broken, 1000);
+    appendVarint(&broken, 0);
+    broken += std::string(999, '\0');
+    writeFile(brokenPath, broken);
+    EXPECT_THROW(readTrace(brokenPath), Exception);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(brokenPath);
+}
@@ -1,6 +1,7 @@
 #include "AudioPlayer.h"
 
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <string>
 #include <filesystem>
@@ -9,6 +10,9 @@
 #include <thread>
 
 #include "Library/Compression/Compression.h"
+#include "Library/Profiler/Profiler.h"
+
+#include "Utility/Streams/MemoryInputStream.h"
 
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Level/Decoration.h"
@@ -16,6 +20,7 @@
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Party.h"
 #include "Engine/Serialization/LegacyImages.h"
+#include "Engine/Spells/Spells.h"
 
 #include "Media/Audio/OpenALSoundProvider.h"
 
@@ -217,29 +222,8 @@ void AudioPlayer::playSound(SoundID eSoundID, int pid, unsigned int uNumRepeats,
     SoundInfo &si = mapSounds[eSoundID];
     //logger->Info("AudioPlayer: sound id {} found as '{}'", eSoundID, si.sName);
 
-    if (!si.dataSource) {
-        Blob buffer;
-
-        if (si.sName == "") {  // enable this for bonus sound effects
-            //logger->Info("AudioPlayer: trying to load bonus sound {}", eSoundID);
-            //buffer = LoadSound(int(eSoundID));
-        } else {
-            buffer = LoadSound(si.sName);
-        }
-
-        if (!buffer) {
-            logger->warning("AudioPlayer: failed to load sound {} ({})", eSoundID, si.sName);
-            return;
-        }
-
-        si.dataSource = CreateAudioBufferDataSource(std::move(buffer));
-        if (!si.dataSource) {
-            logger->warning("AudioPlayer: failed to create sound data source {} ({})", eSoundID, si.sName);
-            return;
-        }
-
-        si.dataSource = PlatformDataSourceInitialize(si.dataSource);
-    }
+    if (!cachedSoundDataSource(eSoundID))
+        return;
 
     PAudioSample sample = CreateAudioSample();
 
@@ -365,7 +349,96 @@ void AudioPlayer::playSound(SoundID eSoundID, int pid, unsigned int uNumRepeats,
     }
 }
 
+PAudioDataSource AudioPlayer::cachedSoundDataSource(SoundID id) {
+    SoundInfo &si = mapSounds[id];
+
+    auto pos = _soundCacheEntries.find(id);
+    if (si.dataSource && pos != _soundCacheEntries.end()) {
+        _soundCacheStats.hits++;
+        _soundCacheLru.splice(_soundCacheLru.begin(), _soundCacheLru, pos->second.lruPos);
+        return si.dataSource;
+    }
+
+    _soundCacheStats.misses++;
+
+    Blob buffer;
+    if (si.sName == "") {  // enable this for bonus sound effects
+        //logger->Info("AudioPlayer: trying to load bonus sound {}", id);
+        //buffer = LoadSound(int(id));
+    } else {
+        buffer = LoadSound(si.sName);
+    }
+
+    if (!buffer) {
+        logger->warning("AudioPlayer: failed to load sound {} ({})", id, si.sName);
+        return nullptr;
+    }
+
+    // Sounds in audio.snd are wavs, so source size is a good enough estimate of the decoded size.
+    size_t size = buffer.size();
+
+    si.dataSource = CreateAudioBufferDataSource(std::move(buffer));
+    if (!si.dataSource) {
+        logger->warning("AudioPlayer: failed to create sound data source {} ({})", id, si.sName);
+        return nullptr;
+    }
+
+    si.dataSource = PlatformDataSourceInitialize(si.dataSource);
+
+    // Decode right away, this would otherwise happen on first play anyway.
+    auto decodeStart = std::chrono::steady_clock::now();
+    si.dataSource->Open();
+    auto decodeTime = std::chrono::steady_clock::now() - decodeStart;
+    _soundCacheStats.decodeTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(decodeTime).count();
+
+    if (pos != _soundCacheEntries.end()) {
+        _soundCacheLru.erase(pos->second.lruPos);
+        _soundCacheStats.memoryUsage -= pos->second.size;
+        _soundCacheEntries.erase(pos);
+    }
+
+    _soundCacheLru.push_front(id);
+    _soundCacheEntries[id] = {_soundCacheLru.begin(), size};
+    _soundCacheStats.memoryUsage += size;
+    evictCachedSounds();
+
+    return si.dataSource;
+}
+
+void AudioPlayer::evictCachedSounds() {
+    size_t budget = static_cast<size_t>(engine->config->settings.SoundCacheSize.value()) * 1024 * 1024;
+
+    // Most recently used sound is never evicted, even if it doesn't fit into the budget on its own.
+    // Samples that are still playing hold their own references to the data source, so it's safe to drop it here.
+    while (_soundCacheStats.memoryUsage > budget && _soundCacheLru.size() > 1) {
+        SoundID id = _soundCacheLru.back();
+        _soundCacheLru.pop_back();
+
+        auto pos = _soundCacheEntries.find(id);
+        _soundCacheStats.memoryUsage -= pos->second.size;
+        _soundCacheStats.evictions++;
+        _soundCacheEntries.erase(pos);
+        mapSounds[id].dataSource = nullptr;
+    }
+}
+
+void AudioPlayer::prewarmSounds(const std::vector<SoundID> &ids) {
+    if (!bPlayerReady || engine->config->debug.NoSound.value())
+        return;
+
+    for (SoundID id : ids) {
+        if (id == SOUND_Invalid || !mapSounds.contains(id))
+            continue;
+        if (mapSounds[id].dataSource && _soundCacheEntries.contains(id))
+            continue; // Already decoded, don't mess with LRU order.
+
+        cachedSoundDataSource(id);
+    }
+}
+
 void AudioPlayer::UpdateSounds() {
+    MM_PROFILE_ZONE("AudioPlayer::UpdateSounds");
+
     float pitch = pi * (float)pParty->_viewPitch / 1024.f;
     float yaw = pi * (float)pParty->_viewYaw / 1024.f;
 
@@ -534,19 +607,31 @@ struct SoundHeader_mm7 {
 void AudioPlayer::LoadAudioSnd() {
     static_assert(sizeof(SoundHeader_mm7) == 52, "Wrong type size");
 
-    std::string file_path = MakeDataPath("sounds", "audio.snd");
-    fAudioSnd.open(MakeDataPath("sounds", "audio.snd"));
+    _audioSnd = Blob::fromFile(MakeDataPath("sounds", "audio.snd")); // Throws on error.
+    MemoryInputStream stream(_audioSnd.data(), _audioSnd.size());
 
     uint32_t uNumSoundHeaders {};
-    fAudioSnd.readOrFail(&uNumSoundHeaders, sizeof(uNumSoundHeaders));
+    stream.readOrFail(&uNumSoundHeaders, sizeof(uNumSoundHeaders));
+
+    // Later entries override earlier ones with the same name.
+    std::map<std::string, SoundHeader> headers;
     for (uint32_t i = 0; i < uNumSoundHeaders; i++) {
         SoundHeader_mm7 header_mm7;
-        fAudioSnd.readOrFail(&header_mm7, sizeof(header_mm7));
+        stream.readOrFail(&header_mm7, sizeof(header_mm7));
         SoundHeader header;
         header.uFileOffset = header_mm7.uFileOffset;
         header.uCompressedSize = header_mm7.uCompressedSize;
         header.uDecompressedSize = header_mm7.uDecompressedSize;
-        mSoundHeaders[toLower(header_mm7.pSoundName)] = header;
+        headers[toLower(header_mm7.pSoundName)] = header;
+    }
+
+    _soundHeaders.clear();
+    _soundHeaders.reserve(headers.size());
+    _soundHeadersByName.clear();
+    _soundHeadersByName.reserve(headers.size());
+    for (const auto &[name, header] : headers) {
+        _soundHeaders.emplace(name, header);
+        _soundHeadersByName.push_back(header);
     }
 }
 
@@ -571,13 +656,43 @@ void PlayLevelMusic() {
 }
 
 
-bool AudioPlayer::FindSound(const std::string &pName, AudioPlayer::SoundHeader *header) {
+void PrewarmLevelSounds() {
+    if (!engine->config->settings.PrewarmLevelSounds.value())
+        return;
+
+    std::vector<SoundID> ids;
+    auto addSpellSounds = [&](SPELL_TYPE spell) {
+        if (spell < SPELL_FIRST_WITH_SPRITE || spell > SPELL_LAST_WITH_SPRITE)
+            return;
+        ids.push_back(static_cast<SoundID>(SpellSoundIds[spell]));
+        ids.push_back(static_cast<SoundID>(SpellSoundIds[spell] + 1)); // Impact sound.
+    };
+
+    for (const Actor &actor : pActors) {
+        for (uint16_t soundId : actor.pSoundSampleIDs)
+            ids.push_back(static_cast<SoundID>(soundId));
+        addSpellSounds(actor.pMonsterInfo.uSpell1ID);
+        addSpellSounds(actor.pMonsterInfo.uSpell2ID);
+    }
+
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    pAudioPlayer->prewarmSounds(ids);
+
+    const SoundCacheStats &stats = pAudioPlayer->soundCacheStats();
+    logger->verbose("AudioPlayer: prewarmed {} level sounds, cache stats: {} hits, {} misses, {} evictions, {}KB used, {}ms spent decoding",
+                    ids.size(), stats.hits, stats.misses, stats.evictions, stats.memoryUsage / 1024, stats.decodeTimeUs / 1000);
+}
+
+
+bool AudioPlayer::FindSound(const std::string &pName, AudioPlayer::SoundHeader *header) const {
     if (header == nullptr) {
         return false;
     }
 
-    std::map<std::string, SoundHeader>::iterator it = mSoundHeaders.find(toLower(pName));
-    if (it == mSoundHeaders.end()) {
+    auto it = _soundHeaders.find(toLower(pName));
+    if (it == _soundHeaders.end()) {
         return false;
     }
 
@@ -587,55 +702,47 @@ bool AudioPlayer::FindSound(const std::string &pName, AudioPlayer::SoundHeader *
 }
 
 
-Blob AudioPlayer::LoadSound(int uSoundID) {  // bit of a kludge (load sound by ID index) - plays some interesting files
-    SoundHeader header = { 0 };
+Blob AudioPlayer::loadSoundData(const SoundHeader &header) const {
+    if (header.uCompressedSize >= header.uDecompressedSize) {
+        if (!header.uDecompressedSize)
+            return Blob();
 
-    if (uSoundID < 0 || uSoundID > mSoundHeaders.size())
-        return {};
+        if (header.uFileOffset > _audioSnd.size() || header.uDecompressedSize > _audioSnd.size() - header.uFileOffset)
+            return Blob();
 
-    // iterate through to get sound by int ID
-    std::map<std::string, SoundHeader>::iterator it = mSoundHeaders.begin();
-    std::advance(it, uSoundID);
+        return _audioSnd.subBlob(header.uFileOffset, header.uDecompressedSize);
+    } else {
+        if (header.uFileOffset > _audioSnd.size() || header.uCompressedSize > _audioSnd.size() - header.uFileOffset)
+            return Blob();
 
-    if (it == mSoundHeaders.end())
-        return {};
+        return zlib::Uncompress(_audioSnd.subBlob(header.uFileOffset, header.uCompressedSize), header.uDecompressedSize);
+    }
+}
 
-    header = it->second;
 
-    fAudioSnd.seek(header.uFileOffset);
-    if (header.uCompressedSize >= header.uDecompressedSize) {
-        header.uCompressedSize = header.uDecompressedSize;
-        if (header.uDecompressedSize) {
-            return Blob::read(fAudioSnd, header.uDecompressedSize);
-        } else {
-            logger->warning("Can't load sound file!");
-            return Blob();
-        }
-    } else {
-        return zlib::Uncompress(Blob::read(fAudioSnd, header.uCompressedSize), header.uDecompressedSize);
-    }
+Blob AudioPlayer::LoadSound(int uSoundID) const {  // bit of a kludge (load sound by ID index) - plays some interesting files
+    // Sound "IDs" here are indices in the list of sounds sorted by name.
+    if (uSoundID < 0 || uSoundID >= _soundHeadersByName.size())
+        return {};
+
+    Blob result = loadSoundData(_soundHeadersByName[uSoundID]);
+    if (!result)
+        logger->warning("Can't load sound file!");
+    return result;
 }
 
 
-Blob AudioPlayer::LoadSound(const std::string &pSoundName) {
+Blob AudioPlayer::LoadSound(const std::string &pSoundName) const {
     SoundHeader header = { 0 };
     if (!FindSound(pSoundName, &header)) {
         logger->warning("AudioPlayer: {} can't load sound header!", pSoundName);
         return Blob();
     }
 
-    fAudioSnd.seek(header.uFileOffset);
-    if (header.uCompressedSize >= header.uDecompressedSize) {
-        header.uCompressedSize = header.uDecompressedSize;
-        if (header.uDecompressedSize) {
-            return Blob::read(fAudioSnd, header.uDecompressedSize);
-        } else {
-            logger->warning("AudioPlayer: {} can't load sound file!", pSoundName);
-            return Blob();
-        }
-    } else {
-        return zlib::Uncompress(Blob::read(fAudioSnd, header.uCompressedSize), header.uDecompressedSize);
-    }
+    Blob result = loadSoundData(header);
+    if (!result)
+        logger->warning("AudioPlayer: {} can't load sound file!", pSoundName);
+    return result;
 }
 
 void AudioPlayer::playSpellSound(SPELL_TYPE spell, unsigned int pid, bool is_impact) {
@@ -1,16 +1,18 @@
 #pragma once
 
+#include <cstdint>
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <string>
 #include <memory>
 #include <list>
+#include <vector>
 
 #include "Utility/Workaround/ToUnderlying.h"
 
 #include "Utility/String.h"
 #include "Utility/Memory/Blob.h"
-#include "Utility/Streams/FileInputStream.h"
 #include "Media/Media.h"
 #include "Engine/MM7.h"
 #include "Engine/Spells/SpellEnums.h"
@@ -47,6 +49,14 @@ class AudioSamplePool {
 };
 
 
+struct SoundCacheStats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t evictions = 0;
+    int64_t decodeTimeUs = 0; // Total time spent decoding sounds, in microseconds.
+    size_t memoryUsage = 0; // Current cache size, in bytes.
+};
+
 class AudioPlayer {
  protected:
     typedef struct SoundHeader {
@@ -71,10 +81,14 @@ class AudioPlayer {
 
     void Initialize();
 
+    /**
+     * Memory-maps audio.snd and builds the sound indices. After this call `FindSound` & `LoadSound` can be safely
+     * called from any thread.
+     */
     void LoadAudioSnd();
-    bool FindSound(const std::string &pName, struct AudioPlayer::SoundHeader *header);
-    Blob LoadSound(const std::string &pSoundName);
-    Blob LoadSound(int uSoundID);
+    bool FindSound(const std::string &pName, struct AudioPlayer::SoundHeader *header) const;
+    Blob LoadSound(const std::string &pSoundName) const;
+    Blob LoadSound(int uSoundID) const;
 
     void SetMasterVolume(int level);
     void SetVoiceVolume(int level);
@@ -124,6 +138,21 @@ class AudioPlayer {
      */
     void playSpellSound(SPELL_TYPE spell, unsigned int pid, bool is_impact = false);
 
+    /**
+     * Decodes the provided sounds ahead of time, so that playing them later doesn't stall on decoding. Sounds are
+     * subject to the usual cache budget, so prewarming more than fits into it is pointless.
+     *
+     * @param ids                       IDs of sounds to decode. Invalid & unknown IDs are skipped.
+     */
+    void prewarmSounds(const std::vector<SoundID> &ids);
+
+    /**
+     * @return                          Decoded sound cache counters, accumulated since startup.
+     */
+    const SoundCacheStats &soundCacheStats() const {
+        return _soundCacheStats;
+    }
+
     /**
      * Play generic UI sound.
      * Generic sounds are played in non-exclusive mode - it meand that each call to this function
@@ -190,8 +219,30 @@ class AudioPlayer {
     float uMusicVolume;
     float uVoiceVolume;
     PAudioTrack pCurrentMusicTrack;
-    FileInputStream fAudioSnd;
-    std::map<std::string, SoundHeader> mSoundHeaders;
+    Blob _audioSnd; // Memory-mapped audio.snd.
+    std::unordered_map<std::string, SoundHeader> _soundHeaders; // Keyed by lowercased name.
+    std::vector<SoundHeader> _soundHeadersByName; // Sorted by lowercased name, for `LoadSound(int)`.
+
+    Blob loadSoundData(const SoundHeader &header) const;
+
+    /**
+     * Returns decoded data source for the provided sound, loading & decoding it if it's not in the cache. Decoded
+     * sounds are kept in `SoundInfo::dataSource`, the cache only tracks their sizes & use order.
+     *
+     * @param id                        ID of the sound.
+     * @return                          Data source for the sound, or `nullptr` on error.
+     */
+    PAudioDataSource cachedSoundDataSource(SoundID id);
+    void evictCachedSounds();
+
+    struct SoundCacheEntry {
+        std::list<SoundID>::iterator lruPos;
+        size_t size = 0;
+    };
+
+    std::list<SoundID> _soundCacheLru; // Most recently used first.
+    std::unordered_map<SoundID, SoundCacheEntry> _soundCacheEntries;
+    SoundCacheStats _soundCacheStats;
 
     AudioSamplePool _voiceSoundPool;
     AudioSamplePool _regularSoundPool;
@@ -214,3 +265,8 @@ extern SoundList *pSoundList;
 extern std::array<float, 10> pSoundVolumeLevels;
 
 void PlayLevelMusic();
+
+/**
+ * Prewarms sounds of the monsters in the current level, see `AudioPlayer::prewarmSounds`.
+ */
+void PrewarmLevelSounds();
@@ -0,0 +1,11 @@
+#include "NullEventLoop.h"
+
+void NullEventLoop::exec(PlatformEventHandler *) {
+    // There are no events to wait for, so there's nothing that could ever make us quit. Return right away.
+}
+
+void NullEventLoop::quit() {}
+
+void NullEventLoop::processMessages(PlatformEventHandler *, int) {}
+
+void NullEventLoop::waitForMessages() {}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Platform/PlatformEventLoop.h"
+
+/**
+ * Event loop that never receives any events.
+ */
+class NullEventLoop : public PlatformEventLoop {
+ public:
+    virtual void exec(PlatformEventHandler *eventHandler) override;
+    virtual void quit() override;
+    virtual void processMessages(PlatformEventHandler *eventHandler, int count = -1) override;
+    virtual void waitForMessages() override;
+};
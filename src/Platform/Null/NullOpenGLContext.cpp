@@ -0,0 +1,15 @@
+#include "NullOpenGLContext.h"
+
+bool NullOpenGLContext::bind() {
+    return true;
+}
+
+bool NullOpenGLContext::unbind() {
+    return true;
+}
+
+void NullOpenGLContext::swapBuffers() {}
+
+void *NullOpenGLContext::getProcAddress(const char *) {
+    return nullptr;
+}
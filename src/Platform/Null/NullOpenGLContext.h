@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Platform/PlatformOpenGLContext.h"
+
+/**
+ * OpenGL context that has no actual OpenGL behind it. It can be bound and swapped, but `getProcAddress` always
+ * returns null.
+ */
+class NullOpenGLContext : public PlatformOpenGLContext {
+ public:
+    virtual bool bind() override;
+    virtual bool unbind() override;
+
+    virtual void swapBuffers() override;
+
+    virtual void *getProcAddress(const char *name) override;
+};
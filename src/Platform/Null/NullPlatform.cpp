@@ -0,0 +1,54 @@
+#include "NullPlatform.h"
+
+#include <cassert>
+
+#include "Platform/PlatformLogger.h"
+
+#include "NullEventLoop.h"
+#include "NullWindow.h"
+
+NullPlatform::NullPlatform(PlatformLogger *logger): _logger(logger), _startTime(std::chrono::steady_clock::now()) {
+    assert(logger);
+}
+
+NullPlatform::~NullPlatform() = default;
+
+std::unique_ptr<PlatformWindow> NullPlatform::createWindow() {
+    return std::make_unique<NullWindow>();
+}
+
+std::unique_ptr<PlatformEventLoop> NullPlatform::createEventLoop() {
+    return std::make_unique<NullEventLoop>();
+}
+
+std::vector<PlatformGamepad *> NullPlatform::gamepads() {
+    return {};
+}
+
+void NullPlatform::setCursorShown(bool cursorShown) {
+    _cursorShown = cursorShown;
+}
+
+bool NullPlatform::isCursorShown() const {
+    return _cursorShown;
+}
+
+std::vector<Recti> NullPlatform::displayGeometries() const {
+    return {Recti(0, 0, 640, 480)};
+}
+
+void NullPlatform::showMessageBox(const std::string &title, const std::string &message) const {
+    _logger->log(PLATFORM_LOG, LOG_ERROR, (title + ": " + message).c_str());
+}
+
+int64_t NullPlatform::tickCount() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _startTime).count();
+}
+
+std::string NullPlatform::winQueryRegistry(const std::wstring &) const {
+    return {};
+}
+
+std::string NullPlatform::storagePath(const PlatformStorage) const {
+    return {};
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Platform/Platform.h"
+
+class PlatformLogger;
+
+/**
+ * Platform that doesn't talk to the OS at all - there is no display, no input and no GPU. Windows & OpenGL contexts
+ * are plain state holders, and event loops never deliver any events.
+ *
+ * This is meant for running the game headless, e.g. for trace playback on CI, where all the input comes from the
+ * event trace through the proxies installed on top of this platform.
+ */
+class NullPlatform : public Platform {
+ public:
+    explicit NullPlatform(PlatformLogger *logger);
+    virtual ~NullPlatform();
+
+    virtual std::unique_ptr<PlatformWindow> createWindow() override;
+    virtual std::unique_ptr<PlatformEventLoop> createEventLoop() override;
+    virtual std::vector<PlatformGamepad *> gamepads() override;
+    virtual void setCursorShown(bool cursorShown) override;
+    virtual bool isCursorShown() const override;
+    virtual std::vector<Recti> displayGeometries() const override;
+    virtual void showMessageBox(const std::string &title, const std::string &message) const override;
+    virtual int64_t tickCount() const override;
+    virtual std::string winQueryRegistry(const std::wstring &path) const override;
+    virtual std::string storagePath(const PlatformStorage type) const override;
+
+ private:
+    PlatformLogger *_logger = nullptr;
+    std::chrono::steady_clock::time_point _startTime;
+    bool _cursorShown = true;
+};
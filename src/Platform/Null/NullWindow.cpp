@@ -0,0 +1,85 @@
+#include "NullWindow.h"
+
+#include "NullOpenGLContext.h"
+
+NullWindow::NullWindow() = default;
+
+NullWindow::~NullWindow() = default;
+
+void NullWindow::setTitle(const std::string &title) {
+    _title = title;
+}
+
+std::string NullWindow::title() const {
+    return _title;
+}
+
+void NullWindow::resize(const Sizei &size) {
+    _size = size;
+}
+
+Sizei NullWindow::size() const {
+    return _size;
+}
+
+void NullWindow::setPosition(const Pointi &pos) {
+    _position = pos;
+}
+
+Pointi NullWindow::position() const {
+    return _position;
+}
+
+void NullWindow::setVisible(bool visible) {
+    _visible = visible;
+}
+
+bool NullWindow::isVisible() const {
+    return _visible;
+}
+
+void NullWindow::setResizable(bool resizable) {
+    _resizable = resizable;
+}
+
+bool NullWindow::isResizable() const {
+    return _resizable;
+}
+
+void NullWindow::setWindowMode(PlatformWindowMode mode) {
+    _windowMode = mode;
+}
+
+PlatformWindowMode NullWindow::windowMode() {
+    return _windowMode;
+}
+
+void NullWindow::setGrabsMouse(bool grabsMouse) {
+    _grabsMouse = grabsMouse;
+}
+
+bool NullWindow::grabsMouse() const {
+    return _grabsMouse;
+}
+
+void NullWindow::setOrientations(PlatformWindowOrientations orientations) {
+    _orientations = orientations;
+}
+
+PlatformWindowOrientations NullWindow::orientations() {
+    return _orientations;
+}
+
+Marginsi NullWindow::frameMargins() const {
+    return Marginsi();
+}
+
+uintptr_t NullWindow::systemHandle() const {
+    return 0;
+}
+
+void NullWindow::activate() {}
+
+std::unique_ptr<PlatformOpenGLContext> NullWindow::createOpenGLContext(const PlatformOpenGLOptions &) {
+    return std::make_unique<NullOpenGLContext>();
+}
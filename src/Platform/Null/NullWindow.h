@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Platform/PlatformWindow.h"
+
+class NullWindow : public PlatformWindow {
+ public:
+    NullWindow();
+    virtual ~NullWindow();
+
+    virtual void setTitle(const std::string &title) override;
+    virtual std::string title() const override;
+
+    virtual void resize(const Sizei &size) override;
+    virtual Sizei size() const override;
+
+    virtual void setPosition(const Pointi &pos) override;
+    virtual Pointi position() const override;
+
+    virtual void setVisible(bool visible) override;
+    virtual bool isVisible() const override;
+
+    virtual void setResizable(bool resizable) override;
+    virtual bool isResizable() const override;
+
+    virtual void setWindowMode(PlatformWindowMode mode) override;
+    virtual PlatformWindowMode windowMode() override;
+
+    virtual void setGrabsMouse(bool grabsMouse) override;
+    virtual bool grabsMouse() const override;
+
+    virtual void setOrientations(PlatformWindowOrientations orientations) override;
+    virtual PlatformWindowOrientations orientations() override;
+
+    virtual Marginsi frameMargins() const override;
+
+    virtual uintptr_t systemHandle() const override;
+
+    virtual void activate() override;
+
+    virtual std::unique_ptr<PlatformOpenGLContext> createOpenGLContext(const PlatformOpenGLOptions &options) override;
+
+ private:
+    std::string _title;
+    Sizei _size = {640, 480};
+    Pointi _position;
+    bool _visible = false;
+    bool _resizable = false;
+    PlatformWindowMode _windowMode = WINDOW_MODE_WINDOWED;
+    bool _grabsMouse = false;
+    PlatformWindowOrientations _orientations;
+};
@@ -0,0 +1,81 @@
+#include "BBoxTree.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+static constexpr int MAX_LEAF_SIZE = 4;
+
+BBoxTree::BBoxTree(std::vector<BBoxf> boxes) : _boxes(std::move(boxes)) {
+    if (_boxes.empty())
+        return;
+
+    _order.resize(_boxes.size());
+    std::iota(_order.begin(), _order.end(), 0);
+    _nodes.reserve(2 * _boxes.size() / MAX_LEAF_SIZE + 1);
+    build(0, _boxes.size());
+}
+
+int BBoxTree::build(int first, int last) {
+    int index = _nodes.size();
+    _nodes.emplace_back();
+
+    BBoxf bounds = _boxes[_order[first]];
+    for (int i = first + 1; i < last; i++)
+        bounds = bounds | _boxes[_order[i]];
+    _nodes[index].bounds = bounds;
+
+    if (last - first <= MAX_LEAF_SIZE) {
+        _nodes[index].first = first;
+        _nodes[index].count = last - first;
+        return index;
+    }
+
+    // Split at the median of box centers along the longest axis.
+    float sizeX = bounds.x2 - bounds.x1;
+    float sizeY = bounds.y2 - bounds.y1;
+    float sizeZ = bounds.z2 - bounds.z1;
+    auto center = [&](int i) {
+        const BBoxf &box = _boxes[i];
+        if (sizeX >= sizeY && sizeX >= sizeZ)
+            return box.x1 + box.x2;
+        if (sizeY >= sizeZ)
+            return box.y1 + box.y2;
+        return box.z1 + box.z2;
+    };
+
+    int middle = first + (last - first) / 2;
+    std::nth_element(_order.begin() + first, _order.begin() + middle, _order.begin() + last,
+                     [&](int l, int r) { return center(l) < center(r); });
+
+    build(first, middle);
+    int right = build(middle, last);
+    _nodes[index].first = right;
+    return index;
+}
+
+void BBoxTree::query(const BBoxf &box, std::vector<int> *result) const {
+    result->clear();
+    if (_nodes.empty())
+        return;
+
+    int stack[64];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node &node = _nodes[stack[--stackSize]];
+        if (!node.bounds.intersects(box))
+            continue;
+
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++)
+                if (_boxes[_order[i]].intersects(box))
+                    result->push_back(_order[i]);
+        } else {
+            int left = &node - _nodes.data() + 1;
+            stack[stackSize++] = node.first;
+            stack[stackSize++] = left;
+        }
+    }
+}
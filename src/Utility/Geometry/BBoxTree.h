@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+
+#include "BBox.h"
+
+/**
+ * Static bounding volume hierarchy over a set of axis-aligned boxes.
+ *
+ * Boxes are referenced by their indices in the array that was passed to the constructor. The tree is built once, and
+ * there is no way to update it afterwards, so it's meant for static geometry.
+ */
+class BBoxTree {
+ public:
+    BBoxTree() = default;
+    explicit BBoxTree(std::vector<BBoxf> boxes);
+
+    [[nodiscard]] bool empty() const {
+        return _boxes.empty();
+    }
+
+    /**
+     * @param box                       Box to look up.
+     * @param[out] result               Indices of all the boxes that intersect `box`, in no particular order.
+     */
+    void query(const BBoxf &box, std::vector<int> *result) const;
+
+ private:
+    struct Node {
+        BBoxf bounds;
+        int first = 0; // For leaves - first index in `_order`, for inner nodes - index of the right child.
+        int count = 0; // Number of boxes in a leaf, zero for inner nodes. Left child is always the next node.
+    };
+
+    int build(int first, int last);
+
+ private:
+    std::vector<BBoxf> _boxes;
+    std::vector<int> _order;
+    std::vector<Node> _nodes;
+};
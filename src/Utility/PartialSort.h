@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace detail {
+template<class Key, class Value>
+void applySortOrder(std::span<Key> keys, std::span<Value> values, const std::vector<size_t> &order) {
+    // Reused between calls so that per-frame callers don't allocate.
+    static thread_local std::vector<Key> oldKeys;
+    static thread_local std::vector<Value> oldValues;
+    oldKeys.assign(std::make_move_iterator(keys.begin()), std::make_move_iterator(keys.end()));
+    oldValues.assign(std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+
+    for (size_t i = 0; i < order.size(); i++) {
+        keys[i] = std::move(oldKeys[order[i]]);
+        values[i] = std::move(oldValues[order[i]]);
+    }
+}
+} // namespace detail
+
+/**
+ * Reorders a key-value pair of parallel arrays so that the `count` elements with the smallest keys come first,
+ * sorted by key. Equal keys keep their relative order, so the first `count` elements end up exactly as they would
+ * after a `std::stable_sort` of the whole range. Order of the remaining elements is unspecified.
+ *
+ * This runs in `O(n + count * log(count))`, and is meant for the cases when only a handful of the nearest /
+ * cheapest / whatever elements out of a large set are needed.
+ *
+ * @param keys                          Keys to sort by.
+ * @param values                        Values to reorder together with the keys, must be the same size as `keys`.
+ * @param count                         Number of elements to select, values larger than `keys.size()` are fine
+ *                                      and result in a full stable sort.
+ */
+template<class Key, class Value>
+void stablePartialSortByKey(std::span<Key> keys, std::span<Value> values, size_t count) {
+    assert(keys.size() == values.size());
+
+    size_t size = keys.size();
+    count = std::min(count, size);
+    if (count == 0)
+        return;
+
+    // Comparing positions for equal keys makes the ordering total, which is what makes this stable.
+    static thread_local std::vector<size_t> order;
+    order.resize(size);
+    for (size_t i = 0; i < size; i++)
+        order[i] = i;
+
+    auto less = [&](size_t l, size_t r) {
+        return keys[l] < keys[r] || (!(keys[r] < keys[l]) && l < r);
+    };
+    if (count < size)
+        std::nth_element(order.begin(), order.begin() + count - 1, order.end(), less);
+    std::sort(order.begin(), order.begin() + count, less);
+
+    detail::applySortOrder(keys, values, order);
+}
+
+/**
+ * Reorders a key-value pair of parallel arrays so that the first `count` elements end up exactly as they would after
+ * the exchange sort that the original game used for actor lists:
+ * \code
+ * for (int i = 0; i < size; i++)
+ *     for (int j = 0; j < i; j++)
+ *         if (keys[j] > keys[i])
+ *             std::swap(elements[i], elements[j]);
+ * \endcode
+ *
+ * That sort is not stable. Each element it moves in front of a run of equal keys sends the first element of that run
+ * to the end of the run. Game logic depends on the order of ties, so this function reproduces it instead of doing the
+ * quadratic sort. The `count` smallest keys are selected first, together with the rest of the run of equal keys that
+ * straddles the `count` boundary, as the tie order decides which of its elements make the cut. The rotations are then
+ * replayed for each run of equal keys in the selection. Replaying a run of `k` keys takes `O(k + min(s, k^2))`, where
+ * `s` is the number of smaller keys, so only runs of the smallest key come for free. Overall this is
+ * `O(n + m * log(m))` plus the replays, where `m` is the size of the selection. Order of the remaining elements is
+ * unspecified.
+ *
+ * @param keys                          Keys to sort by.
+ * @param values                        Values to reorder together with the keys, must be the same size as `keys`.
+ * @param count                         Number of elements to select, values larger than `keys.size()` are fine
+ *                                      and result in a full sort.
+ */
+template<class Key, class Value>
+void legacyExchangeSortByKey(std::span<Key> keys, std::span<Value> values, size_t count) {
+    assert(keys.size() == values.size());
+
+    size_t size = keys.size();
+    count = std::min(count, size);
+    if (count == 0)
+        return;
+
+    static constexpr size_t unselected = static_cast<size_t>(-1);
+    static thread_local std::vector<size_t> order;
+    static thread_local std::vector<size_t> runStarts; // Index in order where each run of equal keys starts.
+    static thread_local std::vector<size_t> runs; // Run index for each position, or `unselected`.
+    static thread_local std::vector<size_t> smallerBefore; // Number of smaller keys preceding each selected position.
+    static thread_local std::vector<size_t> tree; // Fenwick tree over runs.
+    static thread_local std::vector<size_t> next; // Cyclic linked list for replaying a run.
+    static thread_local std::vector<size_t> run;
+
+    order.resize(size);
+    for (size_t i = 0; i < size; i++)
+        order[i] = i;
+
+    size_t selected = size;
+    if (count < size) {
+        std::nth_element(order.begin(), order.begin() + count - 1, order.end(), [&](size_t l, size_t r) {
+            return keys[l] < keys[r];
+        });
+        const Key &boundary = keys[order[count - 1]];
+        auto selectedEnd = std::partition(order.begin() + count, order.end(), [&](size_t i) {
+            return !(boundary < keys[i]);
+        });
+        selected = selectedEnd - order.begin();
+    }
+    std::sort(order.begin(), order.begin() + selected, [&](size_t l, size_t r) {
+        return keys[l] < keys[r] || (!(keys[r] < keys[l]) && l < r);
+    });
+
+    runStarts.clear();
+    runs.assign(size, unselected);
+    for (size_t i = 0; i < selected; i++) {
+        if (i == 0 || keys[order[i - 1]] < keys[order[i]])
+            runStarts.push_back(i);
+        runs[order[i]] = runStarts.size() - 1;
+    }
+    runStarts.push_back(selected);
+
+    // Replay the insertions in the original order, counting the smaller keys inserted before each element. Elements
+    // outside the selection all have larger keys, so they don't affect the selected runs.
+    tree.assign(runStarts.size(), 0);
+    smallerBefore.resize(size);
+    for (size_t i = 0; i < size; i++) {
+        if (runs[i] == unselected)
+            continue;
+
+        size_t smaller = 0;
+        for (size_t j = runs[i]; j > 0; j -= j & -j)
+            smaller += tree[j];
+        smallerBefore[i] = smaller;
+        for (size_t j = runs[i] + 1; j < tree.size(); j += j & -j)
+            tree[j]++;
+    }
+
+    for (size_t r = 0; r + 1 < runStarts.size(); r++) {
+        size_t begin = runStarts[r];
+        size_t end = runStarts[r + 1];
+        size_t runSize = end - begin;
+        if (runSize == 1)
+            continue;
+
+        // Positions in a run are in insertion order. Each smaller key inserted in between rotates the run left by
+        // one. The run is kept as a cycle, so a rotation only moves `tail`, the element before the start of the run,
+        // and appending inserts right after `tail`.
+        next.resize(runSize);
+        next[0] = 0;
+        size_t tail = 0;
+        auto rotate = [&](size_t by, size_t currentSize) {
+            for (size_t i = by % currentSize; i > 0; i--)
+                tail = next[tail];
+        };
+        for (size_t t = 1; t < runSize; t++) {
+            rotate(smallerBefore[order[begin + t]] - smallerBefore[order[begin + t - 1]], t);
+            next[t] = next[tail];
+            next[tail] = t;
+            tail = t;
+        }
+        rotate(begin - smallerBefore[order[end - 1]], runSize);
+
+        run.clear();
+        for (size_t t = next[tail]; run.size() < runSize; t = next[t])
+            run.push_back(order[begin + t]);
+        std::copy(run.begin(), run.end(), order.begin() + begin);
+    }
+
+    detail::applySortOrder(keys, values, order);
+}
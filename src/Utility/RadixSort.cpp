@@ -0,0 +1,35 @@
+#include "RadixSort.h"
+
+#include <array>
+#include <cassert>
+#include <numeric>
+#include <utility>
+
+void radixSortOrder(std::span<const uint32_t> keys, std::vector<uint32_t> *order, std::vector<uint32_t> *scratch) {
+    assert(order != scratch);
+
+    size_t size = keys.size();
+    order->resize(size);
+    scratch->resize(size);
+    std::iota(order->begin(), order->end(), 0);
+
+    // Histograms for all four passes are collected in one go.
+    std::array<std::array<uint32_t, 256>, 4> counts = {};
+    for (uint32_t key : keys)
+        for (int pass = 0; pass < 4; pass++)
+            counts[pass][(key >> (pass * 8)) & 0xFF]++;
+
+    for (int pass = 0; pass < 4; pass++) {
+        std::array<uint32_t, 256> &passCounts = counts[pass];
+        if (size == 0 || passCounts[(keys[0] >> (pass * 8)) & 0xFF] == size)
+            continue; // All keys are in the same bucket, this pass won't change anything.
+
+        uint32_t offset = 0;
+        for (uint32_t &count : passCounts)
+            offset += std::exchange(count, offset);
+
+        for (uint32_t index : *order)
+            (*scratch)[passCounts[(keys[index] >> (pass * 8)) & 0xFF]++] = index;
+        order->swap(*scratch);
+    }
+}
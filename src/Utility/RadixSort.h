@@ -0,0 +1,34 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * Maps a float to an unsigned integer key that sorts in the same order as the original float. The mapping is exact,
+ * so different floats get different keys, except for `0.0f` and `-0.0f` that compare equal and map to the same key.
+ * NaNs sort after `+inf` if their sign bit is clear, and before `-inf` if it's set, so the resulting order is still
+ * total & deterministic.
+ *
+ * @param value                         Float to map.
+ * @return                              Sort key for `value`.
+ */
+[[nodiscard]] inline uint32_t radixSortKey(float value) {
+    if (value == 0.0f)
+        value = 0.0f; // Normalize -0.0f.
+
+    uint32_t bits = std::bit_cast<uint32_t>(value);
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+/**
+ * Computes the stable sort order for the provided keys with an LSD radix sort, in `O(n)`. Byte passes that have all
+ * the keys in the same bucket are skipped, so sorting keys that only differ in a few low bits is even cheaper.
+ *
+ * @param keys                          Keys to sort.
+ * @param[out] order                    Indices into `keys`, in sorted order. Equal keys keep their relative order.
+ *                                      Capacity is reused between the calls.
+ * @param[in,out] scratch               Scratch buffer, capacity is reused between the calls.
+ */
+void radixSortOrder(std::span<const uint32_t> keys, std::vector<uint32_t> *order, std::vector<uint32_t> *scratch);
@@ -3,6 +3,7 @@
 #include <cstdarg>
 #include <vector>
 #include <algorithm>
+#include <cstdint>
 
 #include "Format.h"
 
@@ -77,6 +78,16 @@ bool iless(std::string_view a, std::string_view b) {
     return a.size() < b.size();
 }
 
+size_t ihash(std::string_view s) {
+    // FNV-1a over lowercased chars, so that strings that are iequal hash to the same value.
+    uint64_t result = 14695981039346656037ull;
+    for (char c : s) {
+        result ^= asciiToLower(static_cast<unsigned char>(c));
+        result *= 1099511628211ull;
+    }
+    return static_cast<size_t>(result);
+}
+
 bool iequalsAscii(std::u8string_view a, std::u8string_view b) {
     return iequals(toCharStringView(a), toCharStringView(b));
 }
@@ -44,9 +44,32 @@ bool iless(std::string_view a, std::string_view b);
 bool iequalsAscii(std::u8string_view a, std::u8string_view b);
 bool ilessAscii(std::u8string_view a, std::u8string_view b);
 
+size_t ihash(std::string_view s);
+
 struct ILess {
     bool operator()(std::string_view a, std::string_view b) const {
         return iless(a, b);
     }
 };
 
+/**
+ * Case-insensitive hasher & equality comparator, to be used together for unordered containers keyed by ascii names,
+ * e.g. `std::unordered_map<std::string, int, IHash, IEqual>`. Both are transparent, so lookups with `std::string_view`
+ * don't construct temporary strings.
+ */
+struct IHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view s) const {
+        return ihash(s);
+    }
+};
+
+struct IEqual {
+    using is_transparent = void;
+
+    bool operator()(std::string_view a, std::string_view b) const {
+        return iequals(a, b);
+    }
+};
+
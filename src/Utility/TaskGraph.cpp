@@ -0,0 +1,94 @@
+#include "TaskGraph.h"
+
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+#include "ThreadPool.h"
+
+TaskGraph::TaskId TaskGraph::add(std::string name, std::function<void()> task, const std::vector<TaskId> &dependencies) {
+    TaskId id = _tasks.size();
+
+    for (TaskId dependency : dependencies) {
+        assert(dependency < id);
+        _tasks[dependency].dependents.push_back(id);
+    }
+
+    Task &result = _tasks.emplace_back();
+    result.name = std::move(name);
+    result.body = std::move(task);
+    result.dependencyCount = dependencies.size();
+    return id;
+}
+
+void TaskGraph::run(ThreadPool &pool) {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<size_t> remaining(_tasks.size());
+    std::vector<bool> failed(_tasks.size());
+    std::vector<std::chrono::steady_clock::duration> durations(_tasks.size());
+    std::exception_ptr exception;
+    size_t finished = 0;
+
+    for (TaskId id = 0; id < _tasks.size(); id++)
+        remaining[id] = _tasks[id].dependencyCount;
+
+    // Called with the mutex held. Failed tasks propagate their failure to the dependents, that are then finished
+    // without being run.
+    std::function<void(TaskId)> start;
+    auto finish = [&](TaskId id) {
+        finished++;
+        for (TaskId dependent : _tasks[id].dependents) {
+            if (failed[id])
+                failed[dependent] = true;
+            if (--remaining[dependent] == 0)
+                start(dependent);
+        }
+        if (finished == _tasks.size())
+            condition.notify_all();
+    };
+
+    start = [&](TaskId id) {
+        if (failed[id]) {
+            finish(id);
+            return;
+        }
+
+        pool.run([&, id] {
+            std::exception_ptr taskException;
+            auto startTime = std::chrono::steady_clock::now();
+            try {
+                _tasks[id].body();
+            } catch (...) {
+                taskException = std::current_exception();
+            }
+            auto duration = std::chrono::steady_clock::now() - startTime;
+
+            std::unique_lock lock(mutex);
+            durations[id] = duration;
+            if (taskException) {
+                failed[id] = true;
+                if (!exception)
+                    exception = taskException;
+            }
+            finish(id);
+        });
+    };
+
+    {
+        std::unique_lock lock(mutex);
+        for (TaskId id = 0; id < _tasks.size(); id++)
+            if (remaining[id] == 0)
+                start(id);
+        condition.wait(lock, [&] { return finished == _tasks.size(); });
+    }
+
+    _timings.clear();
+    for (TaskId id = 0; id < _tasks.size(); id++)
+        _timings.push_back({_tasks[id].name, durations[id]});
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
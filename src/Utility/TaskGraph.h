@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * Set of tasks with dependencies between them, that can be run concurrently on a `ThreadPool`.
+ *
+ * Example usage:
+ * \code
+ * TaskGraph graph;
+ * TaskGraph::TaskId blob = graph.add("read", [&] { data = readFile(path); });
+ * graph.add("parse", [&] { table.parse(data); }, {blob});
+ * graph.run(pool);
+ * \endcode
+ */
+class TaskGraph {
+ public:
+    using TaskId = size_t;
+
+    struct TaskTiming {
+        std::string name;
+        std::chrono::steady_clock::duration duration;
+    };
+
+    /**
+     * @param name                      Task name, used only for timings.
+     * @param task                      Task body.
+     * @param dependencies              Tasks that must finish before this one is started. Must be ids returned by
+     *                                  previous calls to `add`, thus the graph can't have cycles.
+     * @return                          Id of the new task.
+     */
+    TaskId add(std::string name, std::function<void()> task, const std::vector<TaskId> &dependencies = {});
+
+    /**
+     * Runs all tasks in the graph and waits for them to finish.
+     *
+     * Must not be called from one of the pool's worker threads as this might deadlock.
+     *
+     * @param pool                      Thread pool to run the tasks on.
+     * @throws ...                      First exception thrown by a task, if any. Tasks that depend on a failed task
+     *                                  are not run, all the other tasks are.
+     */
+    void run(ThreadPool &pool);
+
+    /**
+     * @return                          Run times of the tasks from the last `run` call, in the order of their ids.
+     *                                  Tasks that were skipped because of failed dependencies have zero run times.
+     */
+    [[nodiscard]] const std::vector<TaskTiming> &timings() const {
+        return _timings;
+    }
+
+ private:
+    struct Task {
+        std::string name;
+        std::function<void()> body;
+        std::vector<TaskId> dependents;
+        size_t dependencyCount = 0;
+    };
+
+    std::vector<Task> _tasks;
+    std::vector<TaskTiming> _timings;
+};
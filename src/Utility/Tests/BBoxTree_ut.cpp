@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Geometry/BBoxTree.h"
+
+static BBoxf randomBox(std::mt19937 &gen, float maxSize) {
+    std::uniform_real_distribution<float> pos(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<float> size(0.0f, maxSize);
+
+    BBoxf result;
+    result.x1 = pos(gen);
+    result.y1 = pos(gen);
+    result.z1 = pos(gen);
+    result.x2 = result.x1 + size(gen);
+    result.y2 = result.y1 + size(gen);
+    result.z2 = result.z1 + size(gen);
+    return result;
+}
+
+UNIT_TEST(BBoxTree, Empty) {
+    BBoxTree tree;
+    std::vector<int> result = {1, 2, 3};
+    tree.query(BBoxf::fromPoint(Vec3f(0, 0, 0), 10), &result);
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(result.empty());
+}
+
+UNIT_TEST(BBoxTree, MatchesBruteForce) {
+    std::mt19937 gen(42);
+
+    std::vector<BBoxf> boxes;
+    for (int i = 0; i < 1000; i++)
+        boxes.push_back(randomBox(gen, 100.0f));
+    BBoxTree tree(boxes);
+
+    std::vector<int> result;
+    for (int i = 0; i < 100; i++) {
+        BBoxf box = randomBox(gen, 300.0f);
+
+        std::vector<int> expected;
+        for (int j = 0; j < boxes.size(); j++)
+            if (boxes[j].intersects(box))
+                expected.push_back(j);
+
+        tree.query(box, &result);
+        std::sort(result.begin(), result.end());
+        EXPECT_EQ(result, expected);
+    }
+}
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/PartialSort.h"
+
+UNIT_TEST(PartialSort, Stable) {
+    std::vector<int> keys = {3, 1, 2, 1, 3, 0, 1};
+    std::vector<char> values = {'a', 'b', 'c', 'd', 'e', 'f', 'g'};
+
+    stablePartialSortByKey(std::span(keys), std::span(values), 4);
+    EXPECT_EQ(std::vector<int>(keys.begin(), keys.begin() + 4), std::vector<int>({0, 1, 1, 1}));
+    EXPECT_EQ(std::vector<char>(values.begin(), values.begin() + 4), std::vector<char>({'f', 'b', 'd', 'g'}));
+}
+
+UNIT_TEST(PartialSort, StableRandom) {
+    std::mt19937 gen(42);
+    for (size_t size : {1, 10, 100, 1000}) {
+        std::uniform_int_distribution<int> distribution(0, 20);
+        std::vector<int> keys(size);
+        for (int &key : keys)
+            key = distribution(gen);
+        std::vector<size_t> ids(size);
+        std::iota(ids.begin(), ids.end(), 0);
+
+        std::vector<size_t> expected = ids;
+        std::stable_sort(expected.begin(), expected.end(), [&](size_t l, size_t r) { return keys[l] < keys[r]; });
+
+        for (size_t count : {1, 30, 5000}) {
+            std::vector<int> sortedKeys = keys;
+            std::vector<size_t> sortedIds = ids;
+            stablePartialSortByKey(std::span(sortedKeys), std::span(sortedIds), count);
+
+            for (size_t i = 0; i < std::min(count, size); i++) {
+                EXPECT_EQ(sortedIds[i], expected[i]);
+                EXPECT_EQ(sortedKeys[i], keys[expected[i]]);
+            }
+        }
+    }
+}
+
+UNIT_TEST(PartialSort, LegacyExchange) {
+    // [5a, 5b] + 3 => [3, 5b, 5a], the run of fives gets rotated.
+    std::vector<int> keys = {5, 5, 3};
+    std::vector<char> values = {'a', 'b', 'c'};
+
+    legacyExchangeSortByKey(std::span(keys), std::span(values), 3);
+    EXPECT_EQ(keys, std::vector<int>({3, 5, 5}));
+    EXPECT_EQ(values, std::vector<char>({'c', 'b', 'a'}));
+}
+
+UNIT_TEST(PartialSort, LegacyExchangeRandom) {
+    std::mt19937 gen(42);
+    for (size_t size : {1, 2, 10, 100, 500}) {
+        for (int maxKey : {0, 3, 50, 5632}) {
+            // Clamping to zero gives a large run of smallest keys, same as with actor distances.
+            std::uniform_int_distribution<int> distribution(-maxKey / 4, maxKey);
+            std::vector<int> keys(size);
+            for (int &key : keys)
+                key = std::max(0, distribution(gen));
+            std::vector<size_t> ids(size);
+            std::iota(ids.begin(), ids.end(), 0);
+
+            std::vector<int> expectedKeys = keys;
+            std::vector<size_t> expectedIds = ids;
+            for (size_t i = 0; i < size; i++) {
+                for (size_t j = 0; j < i; j++) {
+                    if (expectedKeys[j] > expectedKeys[i]) {
+                        std::swap(expectedKeys[j], expectedKeys[i]);
+                        std::swap(expectedIds[j], expectedIds[i]);
+                    }
+                }
+            }
+
+            for (size_t count : {1, 30, 5000}) {
+                std::vector<int> sortedKeys = keys;
+                std::vector<size_t> sortedIds = ids;
+                legacyExchangeSortByKey(std::span(sortedKeys), std::span(sortedIds), count);
+
+                for (size_t i = 0; i < std::min(count, size); i++) {
+                    EXPECT_EQ(sortedIds[i], expectedIds[i]);
+                    EXPECT_EQ(sortedKeys[i], expectedKeys[i]);
+                }
+
+                // Everything else is still there.
+                std::sort(sortedIds.begin(), sortedIds.end());
+                EXPECT_EQ(sortedIds, ids);
+            }
+        }
+    }
+}
+
+UNIT_TEST(PartialSort, LegacyExchangeLargeRuns) {
+    // Long runs of equal non-minimal keys with smaller keys interleaved, the run straddling `count` has to be replayed
+    // in full to find out which of its elements make the cut.
+    std::mt19937 gen(42);
+    std::vector<int> keys(3000);
+    for (int &key : keys)
+        key = gen() % 4 == 0 ? 1 : 2;
+    std::vector<size_t> ids(keys.size());
+    std::iota(ids.begin(), ids.end(), 0);
+
+    std::vector<int> expectedKeys = keys;
+    std::vector<size_t> expectedIds = ids;
+    for (size_t i = 0; i < keys.size(); i++) {
+        for (size_t j = 0; j < i; j++) {
+            if (expectedKeys[j] > expectedKeys[i]) {
+                std::swap(expectedKeys[j], expectedKeys[i]);
+                std::swap(expectedIds[j], expectedIds[i]);
+            }
+        }
+    }
+
+    for (size_t count : {30, 1000, 3000}) {
+        std::vector<int> sortedKeys = keys;
+        std::vector<size_t> sortedIds = ids;
+        legacyExchangeSortByKey(std::span(sortedKeys), std::span(sortedIds), count);
+
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_EQ(sortedIds[i], expectedIds[i]);
+            EXPECT_EQ(sortedKeys[i], expectedKeys[i]);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/RadixSort.h"
+
+static constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+static constexpr float Inf = std::numeric_limits<float>::infinity();
+
+// Order that float keys are expected to sort in: -NaN < -inf < ... < -0.0 == 0.0 < ... < inf < NaN.
+static bool floatLess(float l, float r) {
+    auto nanRank = [](float value) { return std::isnan(value) ? (std::signbit(value) ? -1 : 1) : 0; };
+    if (nanRank(l) != nanRank(r))
+        return nanRank(l) < nanRank(r);
+    return l < r;
+}
+
+static std::vector<uint32_t> stableSortOrder(const std::vector<float> &values) {
+    std::vector<uint32_t> result(values.size());
+    std::iota(result.begin(), result.end(), 0);
+    std::stable_sort(result.begin(), result.end(), [&](uint32_t l, uint32_t r) { return floatLess(values[l], values[r]); });
+    return result;
+}
+
+static std::vector<uint32_t> radixSortOrder(const std::vector<float> &values) {
+    std::vector<uint32_t> keys(values.size());
+    for (size_t i = 0; i < values.size(); i++)
+        keys[i] = radixSortKey(values[i]);
+
+    std::vector<uint32_t> result, scratch;
+    radixSortOrder(keys, &result, &scratch);
+    return result;
+}
+
+UNIT_TEST(RadixSort, FloatKeys) {
+    std::vector<float> values = {-NaN, -Inf, -1e30f, -2.5f, -1.0f, -1e-30f, -1e-45f, 0.0f, 1e-45f, 1e-30f, 1.0f,
+                                 1.0000001f, 2.5f, 1e30f, Inf, NaN};
+    for (size_t i = 1; i < values.size(); i++)
+        EXPECT_LT(radixSortKey(values[i - 1]), radixSortKey(values[i])) << values[i - 1] << " vs " << values[i];
+    EXPECT_EQ(radixSortKey(-0.0f), radixSortKey(0.0f));
+}
+
+UNIT_TEST(RadixSort, Stable) {
+    std::vector<uint32_t> keys = {3, 1, 0x10002, 1, 3, 0, 0x10002, 1};
+    std::vector<uint32_t> order, scratch;
+    radixSortOrder(keys, &order, &scratch);
+    EXPECT_EQ(order, std::vector<uint32_t>({5, 1, 3, 7, 0, 4, 2, 6}));
+
+    radixSortOrder({}, &order, &scratch);
+    EXPECT_TRUE(order.empty());
+}
+
+UNIT_TEST(RadixSort, SpecialValues) {
+    // Ties between -0.0 & 0.0, and between equal NaNs, keep their relative order.
+    std::vector<float> values = {1.0f, -0.0f, NaN, 0.0f, -NaN, -1.0f, -0.0f, NaN, -Inf, 0.0f, Inf, -NaN, -2.0f};
+    EXPECT_EQ(radixSortOrder(values), stableSortOrder(values));
+    EXPECT_EQ(radixSortOrder(values), std::vector<uint32_t>({4, 11, 8, 12, 5, 1, 3, 6, 9, 0, 10, 2, 7}));
+}
+
+UNIT_TEST(RadixSort, MatchesStableSort) {
+    std::mt19937 gen(42);
+    const std::vector<float> specials = {NaN, -NaN, Inf, -Inf, 0.0f, -0.0f};
+    for (size_t size : {0, 1, 2, 10, 100, 1000, 5000}) {
+        // Narrow ranges give lots of ties, wide ones exercise all the byte passes.
+        for (float range : {4.0f, 1000.0f, 1e30f}) {
+            std::uniform_real_distribution<float> distribution(-range, range);
+            std::uniform_int_distribution<int> choice(0, 9);
+            std::vector<float> values(size);
+            for (float &value : values) {
+                int kind = choice(gen);
+                if (kind == 0) {
+                    value = specials[gen() % specials.size()];
+                } else if (kind < 5) {
+                    value = std::round(distribution(gen)); // Ties.
+                } else {
+                    value = distribution(gen);
+                }
+            }
+
+            EXPECT_EQ(radixSortOrder(values), stableSortOrder(values)) << "Size " << size << ", range " << range;
+        }
+    }
+}
+
+UNIT_TEST(RadixSort, MatchesStableSortIntegers) {
+    std::mt19937 gen(42);
+    for (uint32_t mask : {0xFu, 0xFF00u, 0xFFFFFFFFu, 0xF000000Fu}) {
+        std::vector<uint32_t> keys(3000);
+        for (uint32_t &key : keys)
+            key = gen() & mask;
+
+        std::vector<uint32_t> expected(keys.size());
+        std::iota(expected.begin(), expected.end(), 0);
+        std::stable_sort(expected.begin(), expected.end(), [&](uint32_t l, uint32_t r) { return keys[l] < keys[r]; });
+
+        std::vector<uint32_t> order, scratch;
+        radixSortOrder(keys, &order, &scratch);
+        EXPECT_EQ(order, expected) << "Mask " << mask;
+    }
+}
@@ -1,3 +1,6 @@
+#include <string>
+#include <unordered_map>
+
 #include "Testing/Unit/UnitTest.h"
 
 #include "Utility/String.h"
@@ -23,3 +26,16 @@ UNIT_TEST(String, iless) {
     EXPECT_FALSE(iless("B", "b"));
     EXPECT_TRUE(iless("@", "`"));
 }
+
+UNIT_TEST(String, ihash) {
+    EXPECT_EQ(ihash("ABC"), ihash("abc"));
+    EXPECT_EQ(ihash("Sprite01.Pcx"), ihash("sPRITE01.pcx"));
+    EXPECT_NE(ihash("abc"), ihash("abd"));
+    EXPECT_NE(ihash("@"), ihash("`"));
+
+    std::unordered_map<std::string, int, IHash, IEqual> map;
+    map["Pending"] = 1;
+    EXPECT_TRUE(map.contains("PENDING"));
+    EXPECT_TRUE(map.contains(std::string_view("pending")));
+    EXPECT_FALSE(map.contains("pendin"));
+}
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/TaskGraph.h"
+#include "Utility/ThreadPool.h"
+
+UNIT_TEST(TaskGraph, Dependencies) {
+    ThreadPool pool(4);
+    TaskGraph graph;
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto task = [&](int value) {
+        return [&, value] {
+            std::unique_lock lock(mutex);
+            order.push_back(value);
+        };
+    };
+
+    TaskGraph::TaskId a = graph.add("a", task(0));
+    TaskGraph::TaskId b = graph.add("b", task(1));
+    TaskGraph::TaskId c = graph.add("c", task(2), {a, b});
+    graph.add("d", task(3), {c});
+    graph.add("e", task(4), {a});
+    graph.run(pool);
+
+    ASSERT_EQ(order.size(), 5);
+    auto position = [&](int value) {
+        return std::find(order.begin(), order.end(), value) - order.begin();
+    };
+    EXPECT_LT(position(0), position(2));
+    EXPECT_LT(position(1), position(2));
+    EXPECT_LT(position(2), position(3));
+    EXPECT_LT(position(0), position(4));
+
+    ASSERT_EQ(graph.timings().size(), 5);
+    EXPECT_EQ(graph.timings()[3].name, "d");
+}
+
+UNIT_TEST(TaskGraph, Exception) {
+    ThreadPool pool(2);
+    TaskGraph graph;
+
+    std::atomic<int> calls = 0;
+    TaskGraph::TaskId a = graph.add("a", [&] { calls++; throw std::runtime_error("a"); });
+    TaskGraph::TaskId b = graph.add("b", [&] { calls++; }, {a});
+    graph.add("c", [&] { calls++; }, {b});
+    graph.add("d", [&] { calls++; });
+
+    EXPECT_THROW(graph.run(pool), std::runtime_error);
+    EXPECT_EQ(calls, 2); // "a" & "d".
+}
+
+UNIT_TEST(TaskGraph, Empty) {
+    ThreadPool pool(1);
+    TaskGraph graph;
+    graph.run(pool);
+    EXPECT_TRUE(graph.timings().empty());
+}
@@ -0,0 +1,66 @@
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/ThreadPool.h"
+
+UNIT_TEST(ThreadPool, Run) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.threadCount(), 4);
+
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 100; i++)
+        futures.push_back(pool.run([i] { return i * i; }));
+
+    for (int i = 0; i < 100; i++)
+        EXPECT_EQ(futures[i].get(), i * i);
+}
+
+UNIT_TEST(ThreadPool, RunException) {
+    ThreadPool pool(2);
+    std::future<void> future = pool.run([] { throw std::runtime_error("42"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+UNIT_TEST(ThreadPool, ParallelFor) {
+    ThreadPool pool(3);
+
+    std::vector<int> values(1000, 0);
+    pool.parallelFor(values.size(), [&](size_t i) { values[i] += static_cast<int>(i); });
+    for (size_t i = 0; i < values.size(); i++)
+        EXPECT_EQ(values[i], i);
+
+    std::atomic<int> calls = 0;
+    EXPECT_THROW(pool.parallelFor(10, [&](size_t i) {
+        calls++;
+        if (i == 5)
+            throw std::runtime_error("5");
+    }), std::runtime_error);
+    EXPECT_EQ(calls, 10);
+}
+
+UNIT_TEST(ThreadPool, ParallelForSingleThread) {
+    ThreadPool pool(1);
+
+    // All iterations are run by the single worker, and are still run after an exception.
+    std::vector<int> calls(10, 0);
+    EXPECT_THROW(pool.parallelFor(calls.size(), [&](size_t i) {
+        calls[i]++;
+        if (i == 2 || i == 5)
+            throw std::runtime_error(std::to_string(i));
+    }), std::runtime_error);
+    EXPECT_EQ(calls, std::vector<int>(10, 1));
+}
+
+UNIT_TEST(ThreadPool, DestructorWaits) {
+    std::atomic<int> counter = 0;
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 50; i++)
+            pool.run([&] { counter++; });
+    }
+    EXPECT_EQ(counter, 50);
+}
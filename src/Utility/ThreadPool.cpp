@@ -0,0 +1,49 @@
+#include "ThreadPool.h"
+
+#include <utility>
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    _threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++)
+        _threads.emplace_back(&ThreadPool::_workerMain, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_all();
+
+    for (std::thread &thread : _threads)
+        thread.join();
+}
+
+void ThreadPool::_push(std::function<void()> task) {
+    {
+        std::unique_lock lock(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+    _condition.notify_one();
+}
+
+void ThreadPool::_workerMain() {
+    while (true) {
+        std::function<void()> task;
+
+        {
+            std::unique_lock lock(_mutex);
+            _condition.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty())
+                return; // _stopping is set & there's nothing left to do.
+
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+
+        task();
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Fixed-size pool of worker threads that execute submitted tasks in FIFO order.
+ *
+ * Destroying the pool waits for all the tasks that were already submitted to finish.
+ *
+ * Example usage:
+ * \code
+ * ThreadPool pool;
+ * std::future<int> answer = pool.run([] { return 42; });
+ * pool.parallelFor(blobs.size(), [&](size_t i) { blobs[i] = zlib::Uncompress(blobs[i]); });
+ * \endcode
+ */
+class ThreadPool {
+ public:
+    /**
+     * @param threadCount               Number of worker threads to start. Zero means one thread per hardware core.
+     */
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    [[nodiscard]] size_t threadCount() const {
+        return _threads.size();
+    }
+
+    /**
+     * @param callable                  Task to run on one of the worker threads.
+     * @return                          Future for the task's result. Exceptions thrown by the task are propagated
+     *                                  through the returned future.
+     */
+    template<class Callable>
+    std::future<std::invoke_result_t<std::decay_t<Callable>>> run(Callable &&callable) {
+        using Result = std::invoke_result_t<std::decay_t<Callable>>;
+
+        // std::function requires copyable callables, thus the shared_ptr.
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Callable>(callable));
+        std::future<Result> result = task->get_future();
+        _push([task] { (*task)(); });
+        return result;
+    }
+
+    /**
+     * Calls `callable(i)` for every `i` in `[0, count)` on the worker threads, and waits for all the calls to finish.
+     *
+     * Must not be called from one of this pool's worker threads as this might deadlock.
+     *
+     * @param count                     Number of iterations.
+     * @param callable                  Loop body, must be safe to call concurrently for different indices.
+     * @throws ...                      First exception thrown by the loop body, if any. Remaining iterations are
+     *                                  still run in this case.
+     */
+    template<class Callable>
+    void parallelFor(size_t count, Callable &&callable) {
+        if (count == 0)
+            return;
+
+        std::atomic<size_t> next = 0;
+        std::mutex exceptionMutex;
+        std::exception_ptr exception;
+        auto body = [&] {
+            // Exceptions are caught per iteration so that a throwing iteration doesn't take the rest of the
+            // job's iterations down with it, e.g. in a single-threaded pool.
+            for (size_t i = next++; i < count; i = next++) {
+                try {
+                    callable(i);
+                } catch (...) {
+                    std::lock_guard lock(exceptionMutex);
+                    if (!exception)
+                        exception = std::current_exception();
+                }
+            }
+        };
+
+        std::vector<std::future<void>> futures;
+        size_t jobCount = std::min(count, threadCount());
+        for (size_t i = 0; i < jobCount; i++)
+            futures.push_back(run(body));
+
+        for (std::future<void> &future : futures)
+            future.get();
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+ private:
+    void _push(std::function<void()> task);
+    void _workerMain();
+
+ private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<std::function<void()>> _tasks;
+    bool _stopping = false;
+    std::vector<std::thread> _threads;
+};
@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/IRender.h"
+#include "Engine/Graphics/RenderBase.h"
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/Items.h"
+#include "Engine/Objects/Player.h"
+#include "Engine/Party.h"
+#include "Engine/mm7_data.h"
+
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Format.h"
+
+// Benchmarks run in the game test harness, but they don't check game logic. Timings are logged, and are also recorded
+// as test properties so that they end up in the XML report.
+
+template<class Callable>
+static int64_t measureUs(Callable &&callable) {
+    auto start = std::chrono::steady_clock::now();
+    callable();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void reportTiming(const std::string &name, int64_t timeUs) {
+    logger->info("{}: {}us", name, timeUs);
+    testing::Test::RecordProperty(name, std::to_string(timeUs));
+}
+
+static void startNewGame(EngineController *game) {
+    game->pressGuiButton("MainMenu_NewGame");
+    game->tick(2);
+    game->pressGuiButton("PartyCreation_OK");
+    game->skipLoadingScreen();
+    game->tick(2);
+}
+
+static ItemGen *wearItem(Player *player, ITEM_TYPE itemId) {
+    player->WearItem(itemId);
+    for (ITEM_SLOT slot : AllItemSlots())
+        if (player->pEquipment.pIndices[slot] && player->GetNthEquippedIndexItem(slot)->uItemID == itemId)
+            return player->GetNthEquippedIndexItem(slot);
+    return nullptr;
+}
+
+GAME_TEST(Render, BillboardSort) {
+    RenderBase *renderBase = dynamic_cast<RenderBase *>(render.get());
+    ASSERT_NE(renderBase, nullptr);
+
+    // Synthetic billboard depths in the range that the renderer produces, with a fair amount of duplicates.
+    constexpr int frameCount = 50;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> distribution(0, 0x4000);
+    for (int size : {100, 1000, 5000, 20000}) {
+        std::vector<float> depths(size);
+        for (float &depth : depths)
+            depth = distribution(gen) / 4.0f;
+
+        int64_t sortTime = measureUs([&] {
+            for (int frame = 0; frame < frameCount; frame++) {
+                renderBase->uNumBillboardsToDraw = 0;
+                for (float depth : depths)
+                    renderBase->AddBillboardD3D()->z_order = depth;
+                renderBase->SortBillboardsD3D();
+            }
+        });
+
+        // Baseline, a stable sort of the same billboards.
+        std::vector<RenderBillboardD3D> billboards(size);
+        int64_t baselineTime = measureUs([&] {
+            for (int frame = 0; frame < frameCount; frame++) {
+                for (int i = 0; i < size; i++)
+                    billboards[i].z_order = depths[i];
+                std::stable_sort(billboards.begin(), billboards.end(), [](const RenderBillboardD3D &l, const RenderBillboardD3D &r) {
+                    return l.z_order < r.z_order;
+                });
+            }
+        });
+
+        ASSERT_EQ(renderBase->uNumBillboardsToDraw, size);
+        for (int i = 1; i < size; i++)
+            ASSERT_LE(renderBase->pBillboardRenderListD3D[i - 1].z_order, renderBase->pBillboardRenderListD3D[i].z_order);
+
+        reportTiming(fmt::format("billboards_{}_sort_us", size), sortTime / frameCount);
+        reportTiming(fmt::format("billboards_{}_stable_sort_us", size), baselineTime / frameCount);
+    }
+
+    renderBase->uNumBillboardsToDraw = 0;
+}
+
+GAME_TEST(Actors, AiListOutdoor) {
+    startNewGame(game);
+
+    // Synthetic actor populations around the party. Some are out of the ai range, and some are touching the party,
+    // so that there are a lot of zero distances.
+    constexpr int iterationCount = 100;
+    std::vector<Actor> savedActors = pActors;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> offset(-6000, 6000);
+    std::uniform_int_distribution<int> radius(0, 300);
+    auto coordinate = [&](int base, int divisor) {
+        return static_cast<int16_t>(std::clamp(base + offset(gen) / divisor, -32768, 32767));
+    };
+    for (int size : {100, 1000, 5000, 10000}) {
+        pActors.assign(size, Actor());
+        for (Actor &actor : pActors) {
+            actor.vPosition = Vec3s(coordinate(pParty->vPosition.x, 1), coordinate(pParty->vPosition.y, 1), coordinate(pParty->vPosition.z, 8));
+            actor.uActorRadius = radius(gen);
+        }
+
+        int64_t time = measureUs([&] {
+            for (int i = 0; i < iterationCount; i++)
+                Actor::MakeActorAIList_ODM();
+        });
+
+        EXPECT_GT(ai_arrays_size, 0);
+        reportTiming(fmt::format("actors_{}_ai_list_us", size), time / iterationCount);
+    }
+
+    pActors = savedActors;
+    Actor::MakeActorAIList_ODM();
+}
+
+GAME_TEST(Prs, Pr870) {
+    // Items bonus cache, checked for correctness by the Prs.Pr870 game test. Validating the cache should stay cheaper
+    // than recomputing the bonuses.
+    startNewGame(game);
+
+    for (Player &player : pParty->pPlayers) {
+        ItemGen *ring = wearItem(&player, ITEM_BRASS_RING);
+        ASSERT_NE(ring, nullptr);
+        ring->uEnchantmentType = CHARACTER_ATTRIBUTE_STRENGTH + 1;
+        ring->m_enchantmentStrength = 5;
+    }
+
+    constexpr int iterationCount = 2000;
+    int64_t cachedSum = 0;
+    int64_t uncachedSum = 0;
+    int64_t cachedTime = measureUs([&] {
+        for (int i = 0; i < iterationCount; i++)
+            for (const Player &player : pParty->pPlayers)
+                for (int attr = 0; attr <= CHARACTER_ATTRIBUTE_SKILL_LEARNING; attr++)
+                    cachedSum += player.GetItemsBonus(static_cast<CHARACTER_ATTRIBUTE_TYPE>(attr));
+    });
+    int64_t uncachedTime = measureUs([&] {
+        for (int i = 0; i < iterationCount; i++)
+            for (const Player &player : pParty->pPlayers)
+                for (int attr = 0; attr <= CHARACTER_ATTRIBUTE_SKILL_LEARNING; attr++)
+                    uncachedSum += player.CalculateItemsBonus(static_cast<CHARACTER_ATTRIBUTE_TYPE>(attr));
+    });
+
+    EXPECT_EQ(cachedSum, uncachedSum);
+    reportTiming("items_bonus_cached_us", cachedTime);
+    reportTiming("items_bonus_uncached_us", uncachedTime);
+}
@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "Application/GameStarter.h"
 #include "Application/GameConfig.h"
+#include "Application/GamePathResolver.h"
 
 #include "Engine/Components/Control/EngineControlComponent.h"
 #include "Engine/Components/Control/EngineController.h"
@@ -11,9 +18,13 @@
 
 #include "Library/Application/PlatformApplication.h"
 
+#include "Platform/Platform.h"
+#include "Platform/PlatformLogger.h"
+
 #include "Utility/Format.h"
 
 #include "GameTestOptions.h"
+#include "GameTestSupervisor.h"
 
 void printGoogleTestHelp(char *app) {
     int argc = 2;
@@ -22,6 +33,34 @@ void printGoogleTestHelp(char *app) {
     testing::InitGoogleTest(&argc, argv);
 }
 
+void setEnvironmentVariable(const char *name, const std::string &value) {
+#ifdef _WINDOWS
+    _putenv_s(name, value.c_str());
+#else
+    setenv(name, value.c_str(), 1);
+#endif
+}
+
+int runSupervisor(GameTestOptions opts, int argc, char **argv) {
+    if (opts.dataPath.empty()) {
+        std::unique_ptr<PlatformLogger> logger = PlatformLogger::createStandardLogger(WIN_ENSURE_CONSOLE_OPTION);
+        std::unique_ptr<Platform> platform = Platform::createStandardPlatform(logger.get());
+        opts.dataPath = resolveMm7Path(platform.get());
+    }
+    if (opts.dataPath.empty())
+        opts.dataPath = std::filesystem::current_path().string();
+
+    // Gtest flags are passed on to the workers, except for the output flag as workers write their own reports.
+    std::vector<std::string> forwardedArgs;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--gtest_") && !arg.starts_with("--gtest_output"))
+            forwardedArgs.push_back(std::move(arg));
+    }
+
+    return runGameTestWorkers(opts, argv[0], forwardedArgs, std::filesystem::current_path() / "game_test_workers");
+}
+
 int platformMain(int argc, char **argv) {
     try {
         GameTestOptions opts = GameTestOptions::Parse(argc, argv);
@@ -31,14 +70,28 @@ int platformMain(int argc, char **argv) {
             return 1;
         }
 
+        if (opts.jobs > 1)
+            return runSupervisor(opts, argc, argv);
+
+        // Gtest picks up sharding settings from the environment.
+        if (opts.shardCount > 1) {
+            setEnvironmentVariable("GTEST_SHARD_INDEX", std::to_string(opts.shardIndex));
+            setEnvironmentVariable("GTEST_TOTAL_SHARDS", std::to_string(opts.shardCount));
+        }
+
         testing::InitGoogleTest(&argc, argv);
+        if (!opts.reportPath.empty())
+            testing::GTEST_FLAG(output) = "xml:" + opts.reportPath;
 
         GameStarter starter(opts);
         starter.config()->resetForTest();
 
         int exitCode = 0;
         starter.application()->get<EngineControlComponent>()->runControlRoutine([&] (EngineController *game) {
-            TestController test(game, opts.testPath);
+            EngineTracePlaybackFlags playbackFlags = 0;
+            if (opts.fastForward)
+                playbackFlags |= TRACE_PLAYBACK_FAST_FORWARD;
+            TestController test(game, opts.testPath, playbackFlags);
 
             GameTest::init(game, &test);
             game->tick(10); // Let the game thread initialize everything.
@@ -1,6 +1,7 @@
 #include "GameTestOptions.h"
 
 #include <memory>
+#include <stdexcept>
 
 #include <CLI/CLI.hpp>
 
@@ -22,6 +23,20 @@ GameTestOptions GameTestOptions::Parse(int argc, char **argv) {
                     "Path to test data dir")->check(CLI::ExistingDirectory)->option_text("PATH")->required()->group(requiredOptions);
     app->add_option("--data-path", result.dataPath,
                     "Path to game data dir")->check(CLI::ExistingDirectory)->option_text("PATH")->group(otherOptions);
+    app->add_option("-j,--jobs", result.jobs,
+                    "Number of worker processes to run the tests in, each worker gets its own copy of the data dir.")->check(CLI::PositiveNumber)->option_text("N")->group(otherOptions);
+    app->add_option("--shard-index", result.shardIndex,
+                    "Index of the test shard to run.")->check(CLI::NonNegativeNumber)->option_text("INDEX")->group(otherOptions);
+    app->add_option("--shard-count", result.shardCount,
+                    "Total number of test shards.")->check(CLI::PositiveNumber)->option_text("COUNT")->group(otherOptions);
+    app->add_option("--report", result.reportPath,
+                    "Write a JUnit-style XML report with per-test timings to PATH.")->option_text("PATH")->group(otherOptions);
+    app->add_option("--config", result.configPath,
+                    "Path to config file, default is 'openenroth_test.ini' in the current folder.")->option_text("PATH")->group(otherOptions);
+    app->add_flag("--headless", result.headless,
+                  "Run without a display, using null platform & renderer.")->group(otherOptions);
+    app->add_flag("--fast-forward", result.fastForward,
+                  "Skip rendering of most frames when playing back traces, game logic is still run for every frame.")->group(otherOptions);
     app->set_help_flag("-h,--help", "Print help and exit.")->group(otherOptions);
     app->allow_extras();
 
@@ -36,5 +51,8 @@ GameTestOptions GameTestOptions::Parse(int argc, char **argv) {
         }
     }
 
+    if (result.shardIndex >= result.shardCount)
+        throw std::runtime_error("--shard-index must be less than --shard-count");
+
     return result;
 }
@@ -9,6 +9,11 @@ class Platform;
 struct GameTestOptions : public GameStarterOptions {
     std::string testPath;
     bool helpPrinted = false;
+    bool fastForward = false; // Skip presentation of most frames when playing back traces.
+    int jobs = 1; // Number of worker processes to spread the tests over, values above 1 turn this process into a supervisor.
+    int shardIndex = 0; // Index of the test shard to run, in [0, shardCount).
+    int shardCount = 1; // Total number of test shards.
+    std::string reportPath; // Path to write a JUnit-style XML report to, empty means don't write a report.
 
     static GameTestOptions Parse(int argc, char **argv);
 };
@@ -0,0 +1,103 @@
+#include "GameTestReports.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+
+#include "Utility/Format.h"
+
+namespace fs = std::filesystem;
+
+static std::string readFile(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream result;
+    result << file.rdbuf();
+    return result.str();
+}
+
+static std::string xmlAttribute(std::string_view tag, std::string_view name) {
+    std::string key = fmt::format(" {}=\"", name);
+    size_t start = tag.find(key);
+    if (start == std::string_view::npos)
+        return {};
+    start += key.size();
+    size_t end = tag.find('"', start);
+    return std::string(tag.substr(start, end - start));
+}
+
+static double xmlNumberAttribute(std::string_view tag, std::string_view name) {
+    std::string value = xmlAttribute(tag, name);
+    return value.empty() ? 0.0 : std::strtod(value.c_str(), nullptr);
+}
+
+/**
+ * Splits an XML document into top-level elements with the given name. Elements are returned verbatim, opening tag
+ * first, so attributes can be looked up with `xmlAttribute`.
+ */
+static std::vector<std::string_view> xmlElements(std::string_view xml, std::string_view name) {
+    std::vector<std::string_view> result;
+    std::string open = fmt::format("<{} ", name);
+    std::string close = fmt::format("</{}>", name);
+
+    size_t pos = 0;
+    while ((pos = xml.find(open, pos)) != std::string_view::npos) {
+        size_t tagEnd = xml.find('>', pos);
+        if (tagEnd == std::string_view::npos)
+            break;
+
+        size_t end = xml[tagEnd - 1] == '/' ? tagEnd + 1 : xml.find(close, tagEnd);
+        if (end == std::string_view::npos)
+            break;
+        if (xml[tagEnd - 1] != '/')
+            end += close.size();
+
+        result.push_back(xml.substr(pos, end - pos));
+        pos = end;
+    }
+    return result;
+}
+
+std::vector<GameTestTiming> collectGameTestTimings(const fs::path &report) {
+    std::string xml = readFile(report);
+    std::vector<GameTestTiming> result;
+    for (std::string_view testCase : xmlElements(xml, "testcase")) {
+        GameTestTiming &timing = result.emplace_back();
+        timing.name = fmt::format("{}.{}", xmlAttribute(testCase, "classname"), xmlAttribute(testCase, "name"));
+        timing.seconds = xmlNumberAttribute(testCase, "time");
+        timing.failed = testCase.find("<failure") != std::string_view::npos;
+    }
+    return result;
+}
+
+bool mergeGameTestReports(const std::vector<fs::path> &inputs, const fs::path &output) {
+    bool complete = true;
+    std::string suites;
+    int tests = 0, failures = 0, disabled = 0, errors = 0;
+    double time = 0;
+
+    for (const fs::path &input : inputs) {
+        if (!fs::exists(input)) {
+            complete = false;
+            continue;
+        }
+
+        std::string report = readFile(input);
+        for (std::string_view suite : xmlElements(report, "testsuite")) {
+            tests += static_cast<int>(xmlNumberAttribute(suite, "tests"));
+            failures += static_cast<int>(xmlNumberAttribute(suite, "failures"));
+            disabled += static_cast<int>(xmlNumberAttribute(suite, "disabled"));
+            errors += static_cast<int>(xmlNumberAttribute(suite, "errors"));
+            time += xmlNumberAttribute(suite, "time");
+            suites += fmt::format("  {}\n", suite);
+        }
+    }
+
+    std::ofstream file(output, std::ios::binary);
+    file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    file << fmt::format("<testsuites tests=\"{}\" failures=\"{}\" disabled=\"{}\" errors=\"{}\" time=\"{:.3f}\" name=\"AllTests\">\n",
+                        tests, failures, disabled, errors, time);
+    file << suites;
+    file << "</testsuites>\n";
+    return complete;
+}
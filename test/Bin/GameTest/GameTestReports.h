@@ -0,0 +1,26 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+struct GameTestTiming {
+    std::string name; // Full test name, `Suite.Test`.
+    double seconds = 0;
+    bool failed = false;
+};
+
+/**
+ * Merges several gtest XML reports into a single JUnit-style report.
+ *
+ * @param inputs                        Reports to merge. Missing reports are skipped, e.g. when a worker crashed.
+ * @param output                        Path to write the merged report to.
+ * @return                              Whether all the input reports were found.
+ */
+bool mergeGameTestReports(const std::vector<std::filesystem::path> &inputs, const std::filesystem::path &output);
+
+/**
+ * @param report                        Path to a gtest XML report.
+ * @return                              Timings of all the test cases in the report, in report order.
+ */
+std::vector<GameTestTiming> collectGameTestTimings(const std::filesystem::path &report);
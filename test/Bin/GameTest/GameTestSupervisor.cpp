@@ -0,0 +1,225 @@
+#include "GameTestSupervisor.h"
+
+#ifdef _WINDOWS
+#   define WIN32_LEAN_AND_MEAN
+#   include <Windows.h>
+#else
+#   include <fcntl.h>
+#   include <spawn.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "Utility/Format.h"
+#include "Utility/String.h"
+
+#include "GameTestOptions.h"
+#include "GameTestReports.h"
+
+#ifndef _WINDOWS
+extern char **environ;
+#endif
+
+namespace fs = std::filesystem;
+
+// Files that the game writes into, these can't be shared between the workers.
+static bool isWorkerPrivatePath(const fs::path &relativePath) {
+    std::string first = toLower(relativePath.begin()->string());
+    std::string name = toLower(relativePath.filename().string());
+    return first == "saves" || name == "new.lod" || toLower(relativePath.extension().string()) == ".ini";
+}
+
+static void prepareWorkerDataPath(const fs::path &dataPath, const fs::path &workerDataPath, const fs::path &workPath) {
+    fs::remove_all(workerDataPath);
+    fs::create_directories(workerDataPath);
+
+    // Work path might be inside the data path, e.g. when both default to the current folder. Walking into it would
+    // make each worker copy the data folders of all the workers before it.
+    fs::path canonicalWorkPath = fs::weakly_canonical(workPath);
+
+    for (auto pos = fs::recursive_directory_iterator(dataPath); pos != fs::recursive_directory_iterator(); ++pos) {
+        const fs::directory_entry &entry = *pos;
+        fs::path relativePath = fs::relative(entry.path(), dataPath);
+        fs::path target = workerDataPath / relativePath;
+
+        if (entry.is_directory()) {
+            if (fs::weakly_canonical(entry.path()) == canonicalWorkPath) {
+                pos.disable_recursion_pending();
+                continue;
+            }
+            fs::create_directories(target);
+        } else if (isWorkerPrivatePath(relativePath)) {
+            fs::copy_file(entry.path(), target);
+        } else {
+            // Symlinks might not be available, e.g. on Windows w/o developer mode. Fall back to copying.
+            std::error_code error;
+            fs::create_symlink(fs::absolute(entry.path()), target, error);
+            if (error)
+                fs::copy_file(entry.path(), target);
+        }
+    }
+}
+
+#ifdef _WINDOWS
+// Quotes an argument so that CommandLineToArgvW & the CRT parse it back verbatim. Backslashes are only special
+// when followed by a quote.
+static std::string quoteWindowsArgument(const std::string &arg) {
+    std::string result = "\"";
+    size_t backslashes = 0;
+    for (char c : arg) {
+        if (c == '\\') {
+            backslashes++;
+            continue;
+        }
+
+        result.append(c == '"' ? backslashes * 2 + 1 : backslashes, '\\');
+        result += c;
+        backslashes = 0;
+    }
+    result.append(backslashes * 2, '\\');
+    result += '"';
+    return result;
+}
+
+static int runProcess(const std::vector<std::string> &args, const fs::path &logPath) {
+    SECURITY_ATTRIBUTES security = {sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE}; // Log handle is inherited.
+    HANDLE log = CreateFileW(logPath.wstring().c_str(), GENERIC_WRITE, FILE_SHARE_READ, &security, CREATE_ALWAYS,
+                             FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (log == INVALID_HANDLE_VALUE)
+        throw std::runtime_error(fmt::format("Could not open '{}' for writing", logPath.string()));
+
+    std::string commandLine;
+    for (const std::string &arg : args)
+        commandLine += quoteWindowsArgument(arg) + " ";
+
+    STARTUPINFOA startupInfo = {};
+    startupInfo.cb = sizeof(startupInfo);
+    startupInfo.dwFlags = STARTF_USESTDHANDLES;
+    startupInfo.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+    startupInfo.hStdOutput = log;
+    startupInfo.hStdError = log;
+
+    // CreateProcess doesn't go through cmd.exe, so the command line is only subject to argv parsing rules.
+    PROCESS_INFORMATION processInfo = {};
+    BOOL created = CreateProcessA(nullptr, commandLine.data(), nullptr, nullptr, TRUE, 0, nullptr, nullptr,
+                                  &startupInfo, &processInfo);
+    CloseHandle(log);
+    if (!created)
+        throw std::runtime_error(fmt::format("Could not start '{}', error {}", args[0], GetLastError()));
+
+    DWORD exitCode = 1;
+    WaitForSingleObject(processInfo.hProcess, INFINITE);
+    GetExitCodeProcess(processInfo.hProcess, &exitCode);
+    CloseHandle(processInfo.hThread);
+    CloseHandle(processInfo.hProcess);
+    return static_cast<int>(exitCode);
+}
+#else
+static int runProcess(const std::vector<std::string> &args, const fs::path &logPath) {
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, logPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+
+    // Arguments are passed as is, there is no shell in between.
+    std::vector<char *> argv;
+    for (const std::string &arg : args)
+        argv.push_back(const_cast<char *>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    pid_t pid;
+    int error = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    if (error != 0)
+        throw std::runtime_error(fmt::format("Could not start '{}': {}", args[0], std::strerror(error)));
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) == -1 && errno == EINTR) {}
+    if (WIFEXITED(status))
+        return WEXITSTATUS(status);
+    return 128 + WTERMSIG(status); // Same as what a shell would report for a signal.
+}
+#endif
+
+int runGameTestWorkers(const GameTestOptions &options, const std::string &executable,
+                       const std::vector<std::string> &forwardedArgs, const fs::path &workPath) {
+    int jobs = options.jobs;
+    fs::create_directories(workPath);
+
+    std::vector<fs::path> reports;
+    std::vector<fs::path> logs;
+    std::vector<std::vector<std::string>> commands;
+    for (int i = 0; i < jobs; i++) {
+        fs::path workerPath = workPath / fmt::format("worker{}", i);
+        fs::path workerDataPath = workerPath / "data";
+        prepareWorkerDataPath(options.dataPath, workerDataPath, workPath);
+
+        reports.push_back(workerPath / "report.xml");
+        logs.push_back(workerPath / "log.txt");
+        fs::remove(reports.back());
+
+        std::vector<std::string> args = {
+            executable,
+            "--test-path", options.testPath,
+            "--data-path", workerDataPath.string(),
+            "--config", (workerDataPath / "openenroth_test.ini").string(),
+            "--shard-index", std::to_string(i),
+            "--shard-count", std::to_string(jobs),
+            fmt::format("--gtest_output=xml:{}", reports.back().string())
+        };
+        if (options.headless)
+            args.push_back("--headless");
+        if (options.fastForward)
+            args.push_back("--fast-forward");
+        args.insert(args.end(), forwardedArgs.begin(), forwardedArgs.end());
+
+        commands.push_back(std::move(args));
+    }
+
+    fmt::print(stdout, "Running game tests in {} workers, see '{}' for logs.\n", jobs, workPath.string());
+
+    std::vector<int> exitCodes(jobs);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < jobs; i++)
+        threads.emplace_back([&, i] {
+            try {
+                exitCodes[i] = runProcess(commands[i], logs[i]);
+            } catch (const std::exception &e) {
+                fmt::print(stderr, "{}\n", e.what());
+                exitCodes[i] = -1;
+            }
+        });
+    for (std::thread &thread : threads)
+        thread.join();
+
+    fs::path reportPath = options.reportPath.empty() ? workPath / "report.xml" : fs::path(options.reportPath);
+    bool complete = mergeGameTestReports(reports, reportPath);
+
+    std::vector<GameTestTiming> timings = collectGameTestTimings(reportPath);
+    std::sort(timings.begin(), timings.end(), [](const GameTestTiming &l, const GameTestTiming &r) {
+        return l.seconds > r.seconds;
+    });
+    for (const GameTestTiming &timing : timings)
+        fmt::print(stdout, "{:>9.3f}s  {}  {}\n", timing.seconds, timing.failed ? "FAILED" : "OK    ", timing.name);
+
+    int failedWorkers = 0;
+    for (int i = 0; i < jobs; i++) {
+        if (exitCodes[i] != 0) {
+            fmt::print(stderr, "Worker {} failed with exit code {}, see '{}'.\n", i, exitCodes[i], logs[i].string());
+            failedWorkers++;
+        }
+    }
+
+    int failedTests = std::count_if(timings.begin(), timings.end(), [](const GameTestTiming &timing) { return timing.failed; });
+    fmt::print(stdout, "{} tests ran, {} failed. Report written to '{}'.\n", timings.size(), failedTests, reportPath.string());
+
+    return (failedWorkers == 0 && failedTests == 0 && complete) ? 0 : 1;
+}
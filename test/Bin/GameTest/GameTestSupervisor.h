@@ -0,0 +1,24 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+struct GameTestOptions;
+
+/**
+ * Runs the game tests in `options.jobs` worker processes, each running a single gtest shard, and waits for all of
+ * them to finish.
+ *
+ * Every worker gets its own view of the data folder under `workPath`, where all directories are real, read-only
+ * game assets are symlinked, and everything the game writes to (saves, `new.lod`, config) is private to the worker.
+ * Worker output is redirected to a log file next to its data folder.
+ *
+ * @param options                       Options as passed to the supervisor.
+ * @param executable                    Path to the game test executable, usually `argv[0]`.
+ * @param forwardedArgs                 Additional arguments to pass to each worker, e.g. `--gtest_filter`.
+ * @param workPath                      Folder to create worker data folders, logs & reports in.
+ * @return                              Process exit code, zero if all the tests have passed.
+ */
+int runGameTestWorkers(const GameTestOptions &options, const std::string &executable,
+                       const std::vector<std::string> &forwardedArgs, const std::filesystem::path &workPath);
@@ -0,0 +1,62 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "GameTestReports.h"
+
+namespace fs = std::filesystem;
+
+static void writeFile(const fs::path &path, const std::string &contents) {
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+}
+
+UNIT_TEST(GameTestReports, Merge) {
+    fs::path dir = fs::temp_directory_path() / "game_test_reports_ut";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    writeFile(dir / "worker0.xml",
+              "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+              "<testsuites tests=\"2\" failures=\"1\" disabled=\"0\" errors=\"0\" time=\"3.5\" name=\"AllTests\">\n"
+              "  <testsuite name=\"Issues\" tests=\"2\" failures=\"1\" disabled=\"0\" errors=\"0\" time=\"3.5\">\n"
+              "    <testcase name=\"Issue1\" status=\"run\" time=\"1.5\" classname=\"Issues\" />\n"
+              "    <testcase name=\"Issue2\" status=\"run\" time=\"2\" classname=\"Issues\">\n"
+              "      <failure message=\"oops\" type=\"\"><![CDATA[oops]]></failure>\n"
+              "    </testcase>\n"
+              "  </testsuite>\n"
+              "</testsuites>\n");
+    writeFile(dir / "worker1.xml",
+              "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+              "<testsuites tests=\"1\" failures=\"0\" disabled=\"1\" errors=\"0\" time=\"4\" name=\"AllTests\">\n"
+              "  <testsuite name=\"Issues\" tests=\"1\" failures=\"0\" disabled=\"1\" errors=\"0\" time=\"4\">\n"
+              "    <testcase name=\"Issue3\" status=\"run\" time=\"4\" classname=\"Issues\" />\n"
+              "  </testsuite>\n"
+              "</testsuites>\n");
+
+    fs::path merged = dir / "merged.xml";
+    EXPECT_TRUE(mergeGameTestReports({dir / "worker0.xml", dir / "worker1.xml"}, merged));
+
+    std::ifstream file(merged, std::ios::binary);
+    std::string xml((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_NE(xml.find("<testsuites tests=\"3\" failures=\"1\" disabled=\"1\" errors=\"0\" time=\"7.500\""), std::string::npos);
+
+    std::vector<GameTestTiming> timings = collectGameTestTimings(merged);
+    ASSERT_EQ(timings.size(), 3);
+    EXPECT_EQ(timings[0].name, "Issues.Issue1");
+    EXPECT_EQ(timings[0].seconds, 1.5);
+    EXPECT_FALSE(timings[0].failed);
+    EXPECT_EQ(timings[1].name, "Issues.Issue2");
+    EXPECT_TRUE(timings[1].failed);
+    EXPECT_EQ(timings[2].name, "Issues.Issue3");
+    EXPECT_EQ(timings[2].seconds, 4.0);
+
+    // Missing reports are skipped, but reported.
+    EXPECT_FALSE(mergeGameTestReports({dir / "worker0.xml", dir / "worker2.xml"}, merged));
+    EXPECT_EQ(collectGameTestTimings(merged).size(), 2);
+
+    fs::remove_all(dir);
+}
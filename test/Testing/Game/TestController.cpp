@@ -12,9 +12,10 @@
 
 #include "Application/GameKeyboardController.h"
 
-TestController::TestController(EngineController *controller, const std::string &testDataPath):
+TestController::TestController(EngineController *controller, const std::string &testDataPath, EngineTracePlaybackFlags playbackFlags):
     _controller(controller),
-    _testDataPath(testDataPath) {}
+    _testDataPath(testDataPath),
+    _playbackFlags(playbackFlags) {}
 
 std::string TestController::fullPathInTestData(const std::string &fileName) {
     return (_testDataPath / fileName).string();
@@ -36,7 +37,7 @@ void TestController::playTraceFromTestData(const std::string &saveName, const st
         _controller,
         fullPathInTestData(saveName),
         fullPathInTestData(traceName),
-        flags,
+        flags | _playbackFlags,
         std::move(postLoadCallback)
     );
 }
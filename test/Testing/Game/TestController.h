@@ -11,7 +11,12 @@ class EngineTracer;
 
 class TestController {
  public:
-    TestController(EngineController *controller, const std::string &testDataPath);
+    /**
+     * @param controller                Engine controller.
+     * @param testDataPath              Path to test data folder.
+     * @param playbackFlags             Flags that are added to every trace playback, e.g. `TRACE_PLAYBACK_FAST_FORWARD`.
+     */
+    TestController(EngineController *controller, const std::string &testDataPath, EngineTracePlaybackFlags playbackFlags = 0);
 
     std::string fullPathInTestData(const std::string &fileName);
 
@@ -26,4 +31,5 @@ class TestController {
  private:
     EngineController *_controller;
     std::filesystem::path _testDataPath;
+    EngineTracePlaybackFlags _playbackFlags;
 };
@@ -8,7 +8,11 @@
 #include "Engine/Tables/ItemTable.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/SaveLoad.h"
+#include "Engine/EngineIocContainer.h"
+#include "Engine/AssetsManager.h"
 #include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/IRender.h"
 
 #include "Utility/DataPath.h"
 #include "Utility/ScopeGuard.h"
@@ -1058,3 +1062,253 @@ GAME_TEST(Issues, Issue816) {
     // Test that encountering trigger event instruction does not assert
     test->playTraceFromTestData("issue_816.mm7", "issue_816.json"); // Should not assert
 }
+
+GAME_TEST(Prs, AsyncTextureLoad) {
+    // Textures that are deleted while being decoded in the background shouldn't be left in the upload queue.
+    engine->config->graphics.AsyncTextureLoading.setValue(true);
+    size_t pending = assets->pendingUploadCount();
+
+    // Load & upload.
+    Texture *loaded = render->CreateTexture("hwsplat04");
+    EXPECT_TRUE(assets->startAsyncLoad(loaded));
+    EXPECT_EQ(assets->pendingUploadCount(), pending + 1);
+    loaded->WaitForAsyncLoad();
+    assets->uploadCompletedTextures(1000);
+    EXPECT_FALSE(loaded->IsAsyncLoadPending());
+    EXPECT_EQ(assets->pendingUploadCount(), pending);
+    EXPECT_GT(loaded->GetWidth(), 0);
+    delete loaded;
+
+    // Cancel & destroy, both while decoding and after decoding has finished.
+    Texture *decoding = render->CreateTexture("hwsplat04");
+    Texture *decoded = render->CreateTexture("plansky3");
+    EXPECT_TRUE(assets->startAsyncLoad(decoding));
+    EXPECT_TRUE(assets->startAsyncLoad(decoded));
+    EXPECT_EQ(assets->pendingUploadCount(), pending + 2);
+    decoded->WaitForAsyncLoad();
+    EXPECT_TRUE(decoded->IsAsyncLoadFinished());
+    delete decoding;
+    delete decoded;
+    EXPECT_EQ(assets->pendingUploadCount(), pending);
+    assets->uploadCompletedTextures(1000); // Should not touch the deleted textures.
+}
+
+GAME_TEST(Prs, AsyncSaving) {
+    // Saves written on the save thread can be loaded back.
+    std::string savesDir = MakeDataPath("saves");
+    std::string savesDirMoved;
+
+    MM_AT_SCOPE_EXIT({
+        std::error_code ec;
+        std::filesystem::remove_all(savesDir);
+        if (!savesDirMoved.empty()) {
+            std::filesystem::rename(savesDirMoved, savesDir, ec); // Using std::error_code here, so can't throw.
+        }
+    });
+
+    if (std::filesystem::exists(savesDir)) {
+        savesDirMoved = savesDir + "_moved_for_testing";
+        ASSERT_FALSE(std::filesystem::exists(savesDirMoved)); // Throws on failure.
+        std::filesystem::rename(savesDir, savesDirMoved);
+    }
+
+    std::filesystem::create_directory(savesDir);
+    engine->config->settings.AsyncSaving.setValue(true);
+
+    game->pressGuiButton("MainMenu_NewGame");
+    game->tick(2);
+    game->pressGuiButton("PartyCreation_OK");
+    game->skipLoadingScreen();
+    game->tick(2);
+
+    pParty->SetGold(12345, true);
+
+    game->pressAndReleaseKey(PlatformKey::Escape);
+    game->tick(2);
+    game->pressGuiButton("GameMenu_SaveGame");
+    game->tick(10);
+    game->pressGuiButton("SaveMenu_Slot0");
+    game->tick(2);
+    game->pressAndReleaseKey(PlatformKey::Digit0);
+    game->tick(2);
+    game->pressGuiButton("SaveMenu_Save");
+    game->tick(2);
+    WaitForPendingSave();
+    EXPECT_TRUE(std::filesystem::exists(MakeDataPath("saves", "save000.mm7")));
+
+    pParty->SetGold(0, true);
+
+    game->pressAndReleaseKey(PlatformKey::Escape);
+    game->tick(2);
+    game->pressGuiButton("GameMenu_LoadGame");
+    game->tick(10);
+    game->pressGuiButton("LoadMenu_Slot0");
+    game->tick(2);
+    game->pressGuiButton("LoadMenu_Load");
+    game->tick(2);
+    game->skipLoadingScreen();
+    game->tick(2);
+
+    EXPECT_EQ(pParty->GetGold(), 12345);
+}
+
+// Reference implementation of ODM_GetFloorLevel that walks all faces of all models, as it was done before the floor
+// faces were indexed by grid cell.
+static int bruteForceOutdoorFloorLevel(const Vec3i &pos, bool *pIsOnWater, int *bmodelPid) {
+    struct Surface {
+        int level;
+        int modelId;
+        int faceId;
+    };
+
+    std::vector<Surface> surfaces;
+    int terrainLevel = GetTerrainHeightsAroundParty2(pos.x, pos.y, pIsOnWater, 0);
+    surfaces.push_back({terrainLevel, -1, -1});
+
+    int slack = engine->config->gameplay.FloorChecksEps.value();
+    for (BSPModel &model : pOutdoor->pBModels) {
+        if (!model.pBoundingBox.containsXY(pos.x, pos.y))
+            continue;
+
+        for (ODMFace &face : model.pFaces) {
+            if (face.Ethereal() || face.uNumVertices == 0)
+                continue;
+            if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
+                continue;
+            if (!face.pBoundingBox.containsXY(pos.x, pos.y) || !face.Contains(pos, model.index, slack, FACE_XY_PLANE))
+                continue;
+
+            int level = face.uPolygonType == POLYGON_Floor ? model.pVertices[face.pVertexIDs[0]].z
+                                                           : face.zCalc.calculate(pos.x, pos.y);
+            if (surfaces.size() < 20)
+                surfaces.push_back({level, model.index, face.index});
+        }
+    }
+
+    size_t idx = 0;
+    for (size_t i = 1; i < surfaces.size(); i++) {
+        if (surfaces[idx].level <= pos.z + 5) {
+            if (surfaces[i].level >= surfaces[idx].level && surfaces[i].level <= pos.z + 5)
+                idx = i;
+        } else if (surfaces[i].level < surfaces[idx].level) {
+            idx = i;
+        }
+    }
+
+    *bmodelPid = idx == 0 ? 0 : surfaces[idx].faceId | (surfaces[idx].modelId << 6);
+    if (idx != 0)
+        *pIsOnWater = pOutdoor->pBModels[surfaces[idx].modelId].pFaces[surfaces[idx].faceId].Fluid();
+    return std::max(terrainLevel, surfaces[idx].level);
+}
+
+GAME_TEST(Prs, OutdoorFloorFaceIndex) {
+    // Floor levels looked up through the grid cell index should match the ones found by walking all faces.
+    game->pressGuiButton("MainMenu_NewGame");
+    game->tick(2);
+    game->pressGuiButton("PartyCreation_OK");
+    game->skipLoadingScreen();
+    game->tick(2);
+
+    ASSERT_EQ(uCurrentlyLoadedLevelType, LEVEL_Outdoor);
+    ASSERT_FALSE(pOutdoor->pBModels.empty());
+
+    // Step is not a divisor of the cell size so that we get to check different positions inside the cells. Range
+    // extends past the map borders to check the clamping.
+    int mismatches = 0;
+    int bmodelHits = 0;
+    for (int y = -34000; y <= 34000; y += 253) {
+        for (int x = -34000; x <= 34000; x += 253) {
+            for (int z : {0, 500, 2000}) {
+                Vec3i pos(x, y, z);
+
+                bool expectedOnWater = false;
+                int expectedPid = 0;
+                int expectedLevel = bruteForceOutdoorFloorLevel(pos, &expectedOnWater, &expectedPid);
+
+                bool onWater = false;
+                int pid = 0;
+                int level = ODM_GetFloorLevel(pos, 0, &onWater, &pid, 0);
+
+                if (level != expectedLevel || pid != expectedPid || onWater != expectedOnWater)
+                    mismatches++;
+                if (expectedPid != 0)
+                    bmodelHits++;
+            }
+        }
+    }
+
+    EXPECT_EQ(mismatches, 0);
+    EXPECT_GT(bmodelHits, 0); // Make sure we've actually tested something.
+}
+
+static void startNewGame(EngineController *game) {
+    game->pressGuiButton("MainMenu_NewGame");
+    game->tick(2);
+    game->pressGuiButton("PartyCreation_OK");
+    game->skipLoadingScreen();
+    game->tick(2);
+}
+
+static ItemGen *wearItem(Player *player, ITEM_TYPE itemId) {
+    player->WearItem(itemId);
+    for (ITEM_SLOT slot : AllItemSlots())
+        if (player->pEquipment.pIndices[slot] && player->GetNthEquippedIndexItem(slot)->uItemID == itemId)
+            return player->GetNthEquippedIndexItem(slot);
+    return nullptr;
+}
+
+GAME_TEST(Prs, Pr870) {
+    // Cached item bonuses should be dropped when equipped items or skills change.
+    startNewGame(game);
+
+    Player &player = pParty->pPlayers[0];
+    auto expectBonuses = [&] {
+        for (int attr = 0; attr <= CHARACTER_ATTRIBUTE_SKILL_LEARNING; attr++) {
+            for (bool mainHand : {false, true}) {
+                CHARACTER_ATTRIBUTE_TYPE type = static_cast<CHARACTER_ATTRIBUTE_TYPE>(attr);
+                EXPECT_EQ(player.GetItemsBonus(type, mainHand), player.CalculateItemsBonus(type, mainHand));
+            }
+        }
+    };
+
+    expectBonuses(); // Fills the cache.
+    int strength = player.GetItemsBonus(CHARACTER_ATTRIBUTE_STRENGTH);
+    int fire = player.GetItemsBonus(CHARACTER_ATTRIBUTE_SKILL_FIRE);
+
+    // Equipping.
+    ItemGen *ring = wearItem(&player, ITEM_BRASS_RING);
+    ASSERT_NE(ring, nullptr);
+    ring->uEnchantmentType = CHARACTER_ATTRIBUTE_STRENGTH + 1;
+    ring->m_enchantmentStrength = 10;
+    EXPECT_EQ(player.GetItemsBonus(CHARACTER_ATTRIBUTE_STRENGTH), strength + 10);
+    expectBonuses();
+
+    // Changing enchantment strength in place.
+    ring->m_enchantmentStrength = 20;
+    EXPECT_EQ(player.GetItemsBonus(CHARACTER_ATTRIBUTE_STRENGTH), strength + 20);
+    expectBonuses();
+
+    // Breaking.
+    ring->SetBroken();
+    EXPECT_EQ(player.GetItemsBonus(CHARACTER_ATTRIBUTE_STRENGTH), strength);
+    expectBonuses();
+
+    // Changing skills, "of Fire Magic" gives half of the fire skill.
+    ItemGen *fireRing = wearItem(&player, ITEM_BRASS_RING); // Replaces the broken ring.
+    ASSERT_NE(fireRing, nullptr);
+    fireRing->uEnchantmentType = 0;
+    fireRing->special_enchantment = ITEM_ENCHANTMENT_OF_FIRE_MAGIC;
+    player.SetSkillLevel(PLAYER_SKILL_FIRE, 10);
+    int fire10 = player.GetItemsBonus(CHARACTER_ATTRIBUTE_SKILL_FIRE);
+    player.SetSkillLevel(PLAYER_SKILL_FIRE, 20);
+    int fire20 = player.GetItemsBonus(CHARACTER_ATTRIBUTE_SKILL_FIRE);
+    EXPECT_NE(fire10, fire20);
+    expectBonuses();
+
+    // Unequipping.
+    for (ITEM_SLOT slot : AllItemSlots())
+        if (player.pEquipment.pIndices[slot] && player.GetNthEquippedIndexItem(slot) == fireRing)
+            player.pEquipment.pIndices[slot] = 0;
+    EXPECT_EQ(player.GetItemsBonus(CHARACTER_ATTRIBUTE_SKILL_FIRE), fire);
+    expectBonuses();
+}